@@ -37,6 +37,20 @@ double findmax_simd_double_parser(const std::vector<std::string>& s) {
   return answer;
 }
 
+double findmax_simd_double_parser_exact(const std::vector<std::string>& s) {
+  double answer = 0;
+  simd_double_parser::number_value x;
+  simd_double_parser::parser_result isok;
+  for (const std::string & st : s) {
+    const char* psz = st.c_str();
+    std::tie(x, isok) = simd_double_parser::parser_exact(psz, psz + st.size());
+    if (isok == simd_double_parser::parser_result::Invalid)
+      throw std::runtime_error("bug in findmax_simd_double_parser_exact");
+    answer = answer > x.d ? answer : x.d;
+  }
+  return answer;
+}
+
 double findmax_fast_double_parser(const std::vector<std::string>& s) {
 	double answer = 0;
 	double x;
@@ -194,7 +208,9 @@ void validate(const std::vector<std::string>& s) {
 		printf("simd_double_parser refused to parse %s\n", st.c_str());
 		throw std::runtime_error("simd_double_parser refused to parse");
     }
-    xref = (std::get<1>(r) == simd_double_parser::parser_result::Double) ? std::get<0>(r).d : (double)std::get<0>(r).l;
+    xref = (std::get<1>(r) == simd_double_parser::parser_result::Double) ? std::get<0>(r).d
+         : (std::get<1>(r) == simd_double_parser::parser_result::ULong) ? (double)std::get<0>(r).ul
+         : (double)std::get<0>(r).l;
     dis = std::abs(xref - x);
 	if (dis > 1E10) {
 		std::cerr << "simd_double_parser disagrees" << std::endl;
@@ -204,6 +220,25 @@ void validate(const std::vector<std::string>& s) {
 		printf("f64_ulp_dist = %d\n", (int)f64_ulp_dist(x, xref));
 		throw std::runtime_error("simd_double_parser disagrees");
 	}
+	xref = strtod(st.data(), NULL);
+	psz = st.c_str();
+	r = simd_double_parser::parser_exact(psz, psz + st.size());
+    if (std::get<1>(r) == simd_double_parser::parser_result::Invalid)
+    {
+		printf("simd_double_parser exact refused to parse %s\n", st.c_str());
+		throw std::runtime_error("simd_double_parser exact refused to parse");
+    }
+    x = (std::get<1>(r) == simd_double_parser::parser_result::Double) ? std::get<0>(r).d
+         : (std::get<1>(r) == simd_double_parser::parser_result::ULong) ? (double)std::get<0>(r).ul
+         : (double)std::get<0>(r).l;
+	if (xref != x) {
+		std::cerr << "simd_double_parser exact disagrees" << std::endl;
+		printf("simd_double_parser exact: %.*e\n", DBL_DIG + 1, x);
+		printf("reference: %.*e\n", DBL_DIG + 1, xref);
+		printf("string: %s\n", st.c_str());
+		printf("f64_ulp_dist = %d\n", (int)f64_ulp_dist(x, xref));
+		throw std::runtime_error("simd_double_parser exact disagrees");
+	}
   }
 }
 
@@ -242,6 +277,15 @@ void process(const std::vector<std::string>& lines, size_t volume) {
 	if (i > 0)
 		printf("simd_double_parser  %.2f MB/s\n", volumeMB * 1000000000 / dif);
 
+    t1 = std::chrono::high_resolution_clock::now();
+	ts = findmax_simd_double_parser_exact(lines);
+	t2 = std::chrono::high_resolution_clock::now();
+	if (ts == 0)
+		printf("bug\n");
+	dif = double(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+	if (i > 0)
+		printf("simd_double_parser_exact  %.2f MB/s\n", volumeMB * 1000000000 / dif);
+
     t1 = std::chrono::high_resolution_clock::now();
     ts = findmax_strtod(lines);
     t2 = std::chrono::high_resolution_clock::now();
@@ -0,0 +1,167 @@
+// Time and footprint of the power-of-ten tables: build it as is for the
+// full tables and with -DFAST_DOUBLE_PARSER_COMPACT_TABLES for the compact
+// ones (make tablebench does both). No dependencies.
+#include "fast_double_parser.h"
+#include "simd_double_parser.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+size_t table_bytes() {
+#ifdef FAST_DOUBLE_PARSER_COMPACT_TABLES
+  return sizeof(fast_double_parser::compact_power_of_ten_high) + sizeof(fast_double_parser::compact_power_of_ten_low) +
+         sizeof(fast_double_parser::compact_powers_of_five) +
+         sizeof(fast_double_parser::compact_power_of_ten_corrections);
+#else
+  return sizeof(fast_double_parser::power_of_ten_mantissa_64) + sizeof(fast_double_parser::mantissa_128) +
+         sizeof(simd_double_parser::DOUBLE_E) + sizeof(simd_double_parser::DOUBLE_NE);
+#endif
+}
+
+double findmax_fast_double_parser(const std::vector<std::string> &s) {
+  double answer = 0;
+  double x;
+  for (const std::string &st : s) {
+    const char *psz = st.c_str();
+    if (!fast_double_parser::parse_number(psz, &x, psz + st.size()))
+      throw std::runtime_error("bug in findmax_fast_double_parser");
+    answer = answer > x ? answer : x;
+  }
+  return answer;
+}
+
+// integers above INT64_MAX come back as ULong
+double simd_value(const std::tuple<simd_double_parser::number_value, simd_double_parser::parser_result> &r) {
+  switch (std::get<1>(r)) {
+  case simd_double_parser::parser_result::Double:
+    return std::get<0>(r).d;
+  case simd_double_parser::parser_result::ULong:
+    return double(std::get<0>(r).ul);
+  default:
+    return double(std::get<0>(r).l);
+  }
+}
+
+double findmax_simd_double_parser_exact(const std::vector<std::string> &s) {
+  double answer = 0;
+  for (const std::string &st : s) {
+    const char *psz = st.c_str();
+    auto r = simd_double_parser::parser_exact(psz, psz + st.size());
+    if (std::get<1>(r) == simd_double_parser::parser_result::Invalid)
+      throw std::runtime_error("bug in findmax_simd_double_parser_exact");
+    double x = simd_value(r);
+    answer = answer > x ? answer : x;
+  }
+  return answer;
+}
+
+double findmax_simd_double_parser(const std::vector<std::string> &s) {
+  double answer = 0;
+  for (const std::string &st : s) {
+    const char *psz = st.c_str();
+    auto r = simd_double_parser::parser(psz, psz + st.size());
+    if (std::get<1>(r) == simd_double_parser::parser_result::Invalid)
+      throw std::runtime_error("bug in findmax_simd_double_parser");
+    double x = simd_value(r);
+    answer = answer > x ? answer : x;
+  }
+  return answer;
+}
+
+typedef double (*findmax_function)(const std::vector<std::string> &);
+
+// Warm: the whole input in a loop, the tables stay in L1. Cold: a few
+// numbers at a time with the caches flushed in between (by walking a
+// buffer larger than the last level cache), as in a process that parses
+// now and then; the time of the walk alone is subtracted.
+void process(const char *name, findmax_function f, const std::vector<std::string> &lines, size_t volume) {
+  const double volumeMB = volume / (1024. * 1024.);
+  std::chrono::high_resolution_clock::time_point t1, t2;
+  double best = 0;
+  for (int trial = 0; trial < 3; trial++) {
+    t1 = std::chrono::high_resolution_clock::now();
+    if (f(lines) == 0)
+      printf("bug\n");
+    t2 = std::chrono::high_resolution_clock::now();
+    double dif = double(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+    best = trial == 0 || dif < best ? dif : best;
+  }
+
+  const size_t batch = 16, batches = 2000;
+  static std::vector<uint64_t> flush(32 * 1024 * 1024 / sizeof(uint64_t), 1);
+  std::vector<std::string> chunk(lines.begin(), lines.begin() + batch);
+  uint64_t sink = 0;
+  double with_parse = 0, without_parse = 0;
+  for (size_t b = 0; b < batches; b++) {
+    for (int parse = 0; parse < 2; parse++) {
+      for (size_t i = 0; i < flush.size(); i += 8)
+        sink += flush[i]++;
+      t1 = std::chrono::high_resolution_clock::now();
+      if (parse)
+        sink += uint64_t(f(chunk));
+      t2 = std::chrono::high_resolution_clock::now();
+      (parse ? with_parse : without_parse) +=
+          double(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+    }
+  }
+  printf("%-26s warm %8.2f MB/s   cold %7.1f ns/number %s\n", name, volumeMB * 1000000000 / best,
+         (with_parse - without_parse) / double(batch * batches), sink == 0 ? "bug" : "");
+}
+
+void run(const std::vector<std::string> &lines, size_t volume) {
+  printf("power tables: %zu bytes (%s)\n", table_bytes(),
+#ifdef FAST_DOUBLE_PARSER_COMPACT_TABLES
+         "compact"
+#else
+         "full"
+#endif
+  );
+  process("fast_double_parser", findmax_fast_double_parser, lines, volume);
+  process("simd_double_parser_exact", findmax_simd_double_parser_exact, lines, volume);
+  process("simd_double_parser", findmax_simd_double_parser, lines, volume);
+}
+
+int main(int argc, char **argv) {
+  std::vector<std::string> lines;
+  size_t volume = 0;
+  if (argc > 1) {
+    std::ifstream inputfile(argv[1]);
+    if (!inputfile) {
+      std::cerr << "can't open " << argv[1] << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::string line;
+    while (getline(inputfile, line)) {
+      volume += line.size();
+      if (!line.empty())
+        lines.push_back(line);
+    }
+  } else {
+    // 17 digits over the whole exponent range, so every parse goes
+    // through the power table
+    std::cout << "parsing random numbers from 1e-300 to 1e300" << std::endl;
+    std::mt19937_64 rng(1234);
+    std::uniform_real_distribution<double> mantissa(1, 10);
+    std::uniform_int_distribution<int> exponent(-300, 300);
+    char buf[64];
+    for (size_t i = 0; i < 1000 * 1000; i++) {
+      snprintf(buf, sizeof(buf), "%.16fe%d", mantissa(rng), exponent(rng));
+      lines.push_back(buf);
+      volume += lines.back().size();
+    }
+  }
+  if (lines.size() < 16) {
+    std::cerr << "need at least 16 numbers" << std::endl;
+    return EXIT_FAILURE;
+  }
+  run(lines, volume);
+}
@@ -12,6 +12,9 @@
 #include <cassert>
 #include <type_traits>
 #include <wchar.h>
+#if __cplusplus >= 202002L
+#include <bit>
+#endif
 
 #ifdef _MSC_VER
 #include <intrin.h>
@@ -27,9 +30,10 @@ namespace fast_double_parser {
         Invalid,
         Long,
         Double,
+        ULong,
     };
 
-#define FASTFLOAT_SMALLEST_POWER -325
+#define FASTFLOAT_SMALLEST_POWER -342
 #define FASTFLOAT_LARGEST_POWER 308
 
 #ifdef _MSC_VER
@@ -54,6 +58,37 @@ namespace fast_double_parser {
 #endif
 #endif // _MSC_VER
 
+// Under C++20, parse_number_base, compute_float_64 and everything they call
+// are constexpr, so that a number can be parsed in a constant expression.
+#if defined(__cpp_lib_bit_cast) && defined(__cpp_lib_is_constant_evaluated)
+#define FAST_DOUBLE_PARSER_HAS_CONSTEXPR20 1
+#define FAST_DOUBLE_PARSER_CONSTEXPR20 constexpr
+#else
+#define FAST_DOUBLE_PARSER_HAS_CONSTEXPR20 0
+#define FAST_DOUBLE_PARSER_CONSTEXPR20
+#endif
+
+// True during constant evaluation, where intrinsics, memcpy and word
+// loads are not allowed: the code takes a plain path instead.
+really_inline constexpr bool is_constant_evaluated() {
+#if FAST_DOUBLE_PARSER_HAS_CONSTEXPR20
+  return std::is_constant_evaluated();
+#else
+  return false;
+#endif
+}
+
+template <class To, class From>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 To bit_cast(const From &from) {
+#if FAST_DOUBLE_PARSER_HAS_CONSTEXPR20
+  return std::bit_cast<To>(from);
+#else
+  To to;
+  memcpy(&to, &from, sizeof(to));
+  return to;
+#endif
+}
+
 struct value128 {
   uint64_t low;
   uint64_t high;
@@ -89,9 +124,24 @@ static really_inline uint64_t _umul128(uint64_t ab, uint64_t cd, uint64_t *hi) {
 }
 #endif
 
-really_inline value128 full_multiplication(uint64_t value1, uint64_t value2) {
+#ifdef FAST_DOUBLE_PARSER_REGULAR_VISUAL_STUDIO
+// full_multiplication from 32-bit products, for constant evaluation
+really_inline constexpr value128 full_multiplication_by_halves(uint64_t a, uint64_t b) {
+  const uint64_t lo_lo = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+  const uint64_t hi_lo = (a >> 32) * (b & 0xFFFFFFFF);
+  const uint64_t lo_hi = (a & 0xFFFFFFFF) * (b >> 32);
+  const uint64_t hi_hi = (a >> 32) * (b >> 32);
+  const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+  return value128{(cross << 32) | (lo_lo & 0xFFFFFFFF), (hi_lo >> 32) + (cross >> 32) + hi_hi};
+}
+#endif
+
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 value128 full_multiplication(uint64_t value1, uint64_t value2) {
   value128 answer;
 #ifdef FAST_DOUBLE_PARSER_REGULAR_VISUAL_STUDIO
+  if (is_constant_evaluated()) {
+    return full_multiplication_by_halves(value1, value2);
+  }
 #ifdef _M_ARM64
   // ARM64 has native support for 64-bit multiplications, no need to emultate
   answer.high = __umulh(value1, value2);
@@ -109,8 +159,14 @@ really_inline value128 full_multiplication(uint64_t value1, uint64_t value2) {
 
 
 /* result might be undefined when input_num is zero */
-really_inline int leading_zeroes(uint64_t input_num) {
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 int leading_zeroes(uint64_t input_num) {
 #ifdef _MSC_VER
+  if (is_constant_evaluated()) {
+    int count = 0;
+    for (; count < 64 && (input_num >> (63 - count)) == 0; count++) {
+    }
+    return count;
+  }
   unsigned long leading_zero = 0;
   // Search the mask data from most significant bit (MSB)
   // to least significant bit (LSB) for a set bit (1).
@@ -123,995 +179,1158 @@ really_inline int leading_zeroes(uint64_t input_num) {
 #endif // _MSC_VER
 }
 
-// Precomputed powers of ten from 10^0 to 10^22. These
-// can be represented exactly using the double type.
-static const double power_of_ten[] = {
-    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
-    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
-
 template<class _Char>
-static really_inline bool is_integer(_Char c) {
+static really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool is_integer(_Char c) {
   return (c >= (_Char)'0' && c <= (_Char)'9');
   // this gets compiled to (uint8_t)(c - '0') <= 9 on all decent compilers
 }
 
-// the mantissas of powers of ten from FASTFLOAT_SMALLEST_POWER to FASTFLOAT_LARGEST_POWER, extended out to sixty four
-// bits
-// This struct will likely get padded to 16 bytes.
-typedef struct {
-  uint64_t mantissa;
-  int32_t exp;
-} components;
-
-// The array power_of_ten_components contain the powers of ten approximated
-// as a 64-bit mantissa, with an exponent part. It goes from 10^
-// FASTFLOAT_SMALLEST_POWER to
-// 10^FASTFLOAT_LARGEST_POWER (inclusively). The mantissa is truncated, and
-// never rounded up.
-// Uses about 10KB.
-static const components power_of_ten_components[] = {
-    {0xa5ced43b7e3e9188L, 7},    {0xcf42894a5dce35eaL, 10},
-    {0x818995ce7aa0e1b2L, 14},   {0xa1ebfb4219491a1fL, 17},
-    {0xca66fa129f9b60a6L, 20},   {0xfd00b897478238d0L, 23},
-    {0x9e20735e8cb16382L, 27},   {0xc5a890362fddbc62L, 30},
-    {0xf712b443bbd52b7bL, 33},   {0x9a6bb0aa55653b2dL, 37},
-    {0xc1069cd4eabe89f8L, 40},   {0xf148440a256e2c76L, 43},
-    {0x96cd2a865764dbcaL, 47},   {0xbc807527ed3e12bcL, 50},
-    {0xeba09271e88d976bL, 53},   {0x93445b8731587ea3L, 57},
-    {0xb8157268fdae9e4cL, 60},   {0xe61acf033d1a45dfL, 63},
-    {0x8fd0c16206306babL, 67},   {0xb3c4f1ba87bc8696L, 70},
-    {0xe0b62e2929aba83cL, 73},   {0x8c71dcd9ba0b4925L, 77},
-    {0xaf8e5410288e1b6fL, 80},   {0xdb71e91432b1a24aL, 83},
-    {0x892731ac9faf056eL, 87},   {0xab70fe17c79ac6caL, 90},
-    {0xd64d3d9db981787dL, 93},   {0x85f0468293f0eb4eL, 97},
-    {0xa76c582338ed2621L, 100},  {0xd1476e2c07286faaL, 103},
-    {0x82cca4db847945caL, 107},  {0xa37fce126597973cL, 110},
-    {0xcc5fc196fefd7d0cL, 113},  {0xff77b1fcbebcdc4fL, 116},
-    {0x9faacf3df73609b1L, 120},  {0xc795830d75038c1dL, 123},
-    {0xf97ae3d0d2446f25L, 126},  {0x9becce62836ac577L, 130},
-    {0xc2e801fb244576d5L, 133},  {0xf3a20279ed56d48aL, 136},
-    {0x9845418c345644d6L, 140},  {0xbe5691ef416bd60cL, 143},
-    {0xedec366b11c6cb8fL, 146},  {0x94b3a202eb1c3f39L, 150},
-    {0xb9e08a83a5e34f07L, 153},  {0xe858ad248f5c22c9L, 156},
-    {0x91376c36d99995beL, 160},  {0xb58547448ffffb2dL, 163},
-    {0xe2e69915b3fff9f9L, 166},  {0x8dd01fad907ffc3bL, 170},
-    {0xb1442798f49ffb4aL, 173},  {0xdd95317f31c7fa1dL, 176},
-    {0x8a7d3eef7f1cfc52L, 180},  {0xad1c8eab5ee43b66L, 183},
-    {0xd863b256369d4a40L, 186},  {0x873e4f75e2224e68L, 190},
-    {0xa90de3535aaae202L, 193},  {0xd3515c2831559a83L, 196},
-    {0x8412d9991ed58091L, 200},  {0xa5178fff668ae0b6L, 203},
-    {0xce5d73ff402d98e3L, 206},  {0x80fa687f881c7f8eL, 210},
-    {0xa139029f6a239f72L, 213},  {0xc987434744ac874eL, 216},
-    {0xfbe9141915d7a922L, 219},  {0x9d71ac8fada6c9b5L, 223},
-    {0xc4ce17b399107c22L, 226},  {0xf6019da07f549b2bL, 229},
-    {0x99c102844f94e0fbL, 233},  {0xc0314325637a1939L, 236},
-    {0xf03d93eebc589f88L, 239},  {0x96267c7535b763b5L, 243},
-    {0xbbb01b9283253ca2L, 246},  {0xea9c227723ee8bcbL, 249},
-    {0x92a1958a7675175fL, 253},  {0xb749faed14125d36L, 256},
-    {0xe51c79a85916f484L, 259},  {0x8f31cc0937ae58d2L, 263},
-    {0xb2fe3f0b8599ef07L, 266},  {0xdfbdcece67006ac9L, 269},
-    {0x8bd6a141006042bdL, 273},  {0xaecc49914078536dL, 276},
-    {0xda7f5bf590966848L, 279},  {0x888f99797a5e012dL, 283},
-    {0xaab37fd7d8f58178L, 286},  {0xd5605fcdcf32e1d6L, 289},
-    {0x855c3be0a17fcd26L, 293},  {0xa6b34ad8c9dfc06fL, 296},
-    {0xd0601d8efc57b08bL, 299},  {0x823c12795db6ce57L, 303},
-    {0xa2cb1717b52481edL, 306},  {0xcb7ddcdda26da268L, 309},
-    {0xfe5d54150b090b02L, 312},  {0x9efa548d26e5a6e1L, 316},
-    {0xc6b8e9b0709f109aL, 319},  {0xf867241c8cc6d4c0L, 322},
-    {0x9b407691d7fc44f8L, 326},  {0xc21094364dfb5636L, 329},
-    {0xf294b943e17a2bc4L, 332},  {0x979cf3ca6cec5b5aL, 336},
-    {0xbd8430bd08277231L, 339},  {0xece53cec4a314ebdL, 342},
-    {0x940f4613ae5ed136L, 346},  {0xb913179899f68584L, 349},
-    {0xe757dd7ec07426e5L, 352},  {0x9096ea6f3848984fL, 356},
-    {0xb4bca50b065abe63L, 359},  {0xe1ebce4dc7f16dfbL, 362},
-    {0x8d3360f09cf6e4bdL, 366},  {0xb080392cc4349decL, 369},
-    {0xdca04777f541c567L, 372},  {0x89e42caaf9491b60L, 376},
-    {0xac5d37d5b79b6239L, 379},  {0xd77485cb25823ac7L, 382},
-    {0x86a8d39ef77164bcL, 386},  {0xa8530886b54dbdebL, 389},
-    {0xd267caa862a12d66L, 392},  {0x8380dea93da4bc60L, 396},
-    {0xa46116538d0deb78L, 399},  {0xcd795be870516656L, 402},
-    {0x806bd9714632dff6L, 406},  {0xa086cfcd97bf97f3L, 409},
-    {0xc8a883c0fdaf7df0L, 412},  {0xfad2a4b13d1b5d6cL, 415},
-    {0x9cc3a6eec6311a63L, 419},  {0xc3f490aa77bd60fcL, 422},
-    {0xf4f1b4d515acb93bL, 425},  {0x991711052d8bf3c5L, 429},
-    {0xbf5cd54678eef0b6L, 432},  {0xef340a98172aace4L, 435},
-    {0x9580869f0e7aac0eL, 439},  {0xbae0a846d2195712L, 442},
-    {0xe998d258869facd7L, 445},  {0x91ff83775423cc06L, 449},
-    {0xb67f6455292cbf08L, 452},  {0xe41f3d6a7377eecaL, 455},
-    {0x8e938662882af53eL, 459},  {0xb23867fb2a35b28dL, 462},
-    {0xdec681f9f4c31f31L, 465},  {0x8b3c113c38f9f37eL, 469},
-    {0xae0b158b4738705eL, 472},  {0xd98ddaee19068c76L, 475},
-    {0x87f8a8d4cfa417c9L, 479},  {0xa9f6d30a038d1dbcL, 482},
-    {0xd47487cc8470652bL, 485},  {0x84c8d4dfd2c63f3bL, 489},
-    {0xa5fb0a17c777cf09L, 492},  {0xcf79cc9db955c2ccL, 495},
-    {0x81ac1fe293d599bfL, 499},  {0xa21727db38cb002fL, 502},
-    {0xca9cf1d206fdc03bL, 505},  {0xfd442e4688bd304aL, 508},
-    {0x9e4a9cec15763e2eL, 512},  {0xc5dd44271ad3cdbaL, 515},
-    {0xf7549530e188c128L, 518},  {0x9a94dd3e8cf578b9L, 522},
-    {0xc13a148e3032d6e7L, 525},  {0xf18899b1bc3f8ca1L, 528},
-    {0x96f5600f15a7b7e5L, 532},  {0xbcb2b812db11a5deL, 535},
-    {0xebdf661791d60f56L, 538},  {0x936b9fcebb25c995L, 542},
-    {0xb84687c269ef3bfbL, 545},  {0xe65829b3046b0afaL, 548},
-    {0x8ff71a0fe2c2e6dcL, 552},  {0xb3f4e093db73a093L, 555},
-    {0xe0f218b8d25088b8L, 558},  {0x8c974f7383725573L, 562},
-    {0xafbd2350644eeacfL, 565},  {0xdbac6c247d62a583L, 568},
-    {0x894bc396ce5da772L, 572},  {0xab9eb47c81f5114fL, 575},
-    {0xd686619ba27255a2L, 578},  {0x8613fd0145877585L, 582},
-    {0xa798fc4196e952e7L, 585},  {0xd17f3b51fca3a7a0L, 588},
-    {0x82ef85133de648c4L, 592},  {0xa3ab66580d5fdaf5L, 595},
-    {0xcc963fee10b7d1b3L, 598},  {0xffbbcfe994e5c61fL, 601},
-    {0x9fd561f1fd0f9bd3L, 605},  {0xc7caba6e7c5382c8L, 608},
-    {0xf9bd690a1b68637bL, 611},  {0x9c1661a651213e2dL, 615},
-    {0xc31bfa0fe5698db8L, 618},  {0xf3e2f893dec3f126L, 621},
-    {0x986ddb5c6b3a76b7L, 625},  {0xbe89523386091465L, 628},
-    {0xee2ba6c0678b597fL, 631},  {0x94db483840b717efL, 635},
-    {0xba121a4650e4ddebL, 638},  {0xe896a0d7e51e1566L, 641},
-    {0x915e2486ef32cd60L, 645},  {0xb5b5ada8aaff80b8L, 648},
-    {0xe3231912d5bf60e6L, 651},  {0x8df5efabc5979c8fL, 655},
-    {0xb1736b96b6fd83b3L, 658},  {0xddd0467c64bce4a0L, 661},
-    {0x8aa22c0dbef60ee4L, 665},  {0xad4ab7112eb3929dL, 668},
-    {0xd89d64d57a607744L, 671},  {0x87625f056c7c4a8bL, 675},
-    {0xa93af6c6c79b5d2dL, 678},  {0xd389b47879823479L, 681},
-    {0x843610cb4bf160cbL, 685},  {0xa54394fe1eedb8feL, 688},
-    {0xce947a3da6a9273eL, 691},  {0x811ccc668829b887L, 695},
-    {0xa163ff802a3426a8L, 698},  {0xc9bcff6034c13052L, 701},
-    {0xfc2c3f3841f17c67L, 704},  {0x9d9ba7832936edc0L, 708},
-    {0xc5029163f384a931L, 711},  {0xf64335bcf065d37dL, 714},
-    {0x99ea0196163fa42eL, 718},  {0xc06481fb9bcf8d39L, 721},
-    {0xf07da27a82c37088L, 724},  {0x964e858c91ba2655L, 728},
-    {0xbbe226efb628afeaL, 731},  {0xeadab0aba3b2dbe5L, 734},
-    {0x92c8ae6b464fc96fL, 738},  {0xb77ada0617e3bbcbL, 741},
-    {0xe55990879ddcaabdL, 744},  {0x8f57fa54c2a9eab6L, 748},
-    {0xb32df8e9f3546564L, 751},  {0xdff9772470297ebdL, 754},
-    {0x8bfbea76c619ef36L, 758},  {0xaefae51477a06b03L, 761},
-    {0xdab99e59958885c4L, 764},  {0x88b402f7fd75539bL, 768},
-    {0xaae103b5fcd2a881L, 771},  {0xd59944a37c0752a2L, 774},
-    {0x857fcae62d8493a5L, 778},  {0xa6dfbd9fb8e5b88eL, 781},
-    {0xd097ad07a71f26b2L, 784},  {0x825ecc24c873782fL, 788},
-    {0xa2f67f2dfa90563bL, 791},  {0xcbb41ef979346bcaL, 794},
-    {0xfea126b7d78186bcL, 797},  {0x9f24b832e6b0f436L, 801},
-    {0xc6ede63fa05d3143L, 804},  {0xf8a95fcf88747d94L, 807},
-    {0x9b69dbe1b548ce7cL, 811},  {0xc24452da229b021bL, 814},
-    {0xf2d56790ab41c2a2L, 817},  {0x97c560ba6b0919a5L, 821},
-    {0xbdb6b8e905cb600fL, 824},  {0xed246723473e3813L, 827},
-    {0x9436c0760c86e30bL, 831},  {0xb94470938fa89bceL, 834},
-    {0xe7958cb87392c2c2L, 837},  {0x90bd77f3483bb9b9L, 841},
-    {0xb4ecd5f01a4aa828L, 844},  {0xe2280b6c20dd5232L, 847},
-    {0x8d590723948a535fL, 851},  {0xb0af48ec79ace837L, 854},
-    {0xdcdb1b2798182244L, 857},  {0x8a08f0f8bf0f156bL, 861},
-    {0xac8b2d36eed2dac5L, 864},  {0xd7adf884aa879177L, 867},
-    {0x86ccbb52ea94baeaL, 871},  {0xa87fea27a539e9a5L, 874},
-    {0xd29fe4b18e88640eL, 877},  {0x83a3eeeef9153e89L, 881},
-    {0xa48ceaaab75a8e2bL, 884},  {0xcdb02555653131b6L, 887},
-    {0x808e17555f3ebf11L, 891},  {0xa0b19d2ab70e6ed6L, 894},
-    {0xc8de047564d20a8bL, 897},  {0xfb158592be068d2eL, 900},
-    {0x9ced737bb6c4183dL, 904},  {0xc428d05aa4751e4cL, 907},
-    {0xf53304714d9265dfL, 910},  {0x993fe2c6d07b7fabL, 914},
-    {0xbf8fdb78849a5f96L, 917},  {0xef73d256a5c0f77cL, 920},
-    {0x95a8637627989aadL, 924},  {0xbb127c53b17ec159L, 927},
-    {0xe9d71b689dde71afL, 930},  {0x9226712162ab070dL, 934},
-    {0xb6b00d69bb55c8d1L, 937},  {0xe45c10c42a2b3b05L, 940},
-    {0x8eb98a7a9a5b04e3L, 944},  {0xb267ed1940f1c61cL, 947},
-    {0xdf01e85f912e37a3L, 950},  {0x8b61313bbabce2c6L, 954},
-    {0xae397d8aa96c1b77L, 957},  {0xd9c7dced53c72255L, 960},
-    {0x881cea14545c7575L, 964},  {0xaa242499697392d2L, 967},
-    {0xd4ad2dbfc3d07787L, 970},  {0x84ec3c97da624ab4L, 974},
-    {0xa6274bbdd0fadd61L, 977},  {0xcfb11ead453994baL, 980},
-    {0x81ceb32c4b43fcf4L, 984},  {0xa2425ff75e14fc31L, 987},
-    {0xcad2f7f5359a3b3eL, 990},  {0xfd87b5f28300ca0dL, 993},
-    {0x9e74d1b791e07e48L, 997},  {0xc612062576589ddaL, 1000},
-    {0xf79687aed3eec551L, 1003}, {0x9abe14cd44753b52L, 1007},
-    {0xc16d9a0095928a27L, 1010}, {0xf1c90080baf72cb1L, 1013},
-    {0x971da05074da7beeL, 1017}, {0xbce5086492111aeaL, 1020},
-    {0xec1e4a7db69561a5L, 1023}, {0x9392ee8e921d5d07L, 1027},
-    {0xb877aa3236a4b449L, 1030}, {0xe69594bec44de15bL, 1033},
-    {0x901d7cf73ab0acd9L, 1037}, {0xb424dc35095cd80fL, 1040},
-    {0xe12e13424bb40e13L, 1043}, {0x8cbccc096f5088cbL, 1047},
-    {0xafebff0bcb24aafeL, 1050}, {0xdbe6fecebdedd5beL, 1053},
-    {0x89705f4136b4a597L, 1057}, {0xabcc77118461cefcL, 1060},
-    {0xd6bf94d5e57a42bcL, 1063}, {0x8637bd05af6c69b5L, 1067},
-    {0xa7c5ac471b478423L, 1070}, {0xd1b71758e219652bL, 1073},
-    {0x83126e978d4fdf3bL, 1077}, {0xa3d70a3d70a3d70aL, 1080},
-    {0xccccccccccccccccL, 1083}, {0x8000000000000000L, 1087},
-    {0xa000000000000000L, 1090}, {0xc800000000000000L, 1093},
-    {0xfa00000000000000L, 1096}, {0x9c40000000000000L, 1100},
-    {0xc350000000000000L, 1103}, {0xf424000000000000L, 1106},
-    {0x9896800000000000L, 1110}, {0xbebc200000000000L, 1113},
-    {0xee6b280000000000L, 1116}, {0x9502f90000000000L, 1120},
-    {0xba43b74000000000L, 1123}, {0xe8d4a51000000000L, 1126},
-    {0x9184e72a00000000L, 1130}, {0xb5e620f480000000L, 1133},
-    {0xe35fa931a0000000L, 1136}, {0x8e1bc9bf04000000L, 1140},
-    {0xb1a2bc2ec5000000L, 1143}, {0xde0b6b3a76400000L, 1146},
-    {0x8ac7230489e80000L, 1150}, {0xad78ebc5ac620000L, 1153},
-    {0xd8d726b7177a8000L, 1156}, {0x878678326eac9000L, 1160},
-    {0xa968163f0a57b400L, 1163}, {0xd3c21bcecceda100L, 1166},
-    {0x84595161401484a0L, 1170}, {0xa56fa5b99019a5c8L, 1173},
-    {0xcecb8f27f4200f3aL, 1176}, {0x813f3978f8940984L, 1180},
-    {0xa18f07d736b90be5L, 1183}, {0xc9f2c9cd04674edeL, 1186},
-    {0xfc6f7c4045812296L, 1189}, {0x9dc5ada82b70b59dL, 1193},
-    {0xc5371912364ce305L, 1196}, {0xf684df56c3e01bc6L, 1199},
-    {0x9a130b963a6c115cL, 1203}, {0xc097ce7bc90715b3L, 1206},
-    {0xf0bdc21abb48db20L, 1209}, {0x96769950b50d88f4L, 1213},
-    {0xbc143fa4e250eb31L, 1216}, {0xeb194f8e1ae525fdL, 1219},
-    {0x92efd1b8d0cf37beL, 1223}, {0xb7abc627050305adL, 1226},
-    {0xe596b7b0c643c719L, 1229}, {0x8f7e32ce7bea5c6fL, 1233},
-    {0xb35dbf821ae4f38bL, 1236}, {0xe0352f62a19e306eL, 1239},
-    {0x8c213d9da502de45L, 1243}, {0xaf298d050e4395d6L, 1246},
-    {0xdaf3f04651d47b4cL, 1249}, {0x88d8762bf324cd0fL, 1253},
-    {0xab0e93b6efee0053L, 1256}, {0xd5d238a4abe98068L, 1259},
-    {0x85a36366eb71f041L, 1263}, {0xa70c3c40a64e6c51L, 1266},
-    {0xd0cf4b50cfe20765L, 1269}, {0x82818f1281ed449fL, 1273},
-    {0xa321f2d7226895c7L, 1276}, {0xcbea6f8ceb02bb39L, 1279},
-    {0xfee50b7025c36a08L, 1282}, {0x9f4f2726179a2245L, 1286},
-    {0xc722f0ef9d80aad6L, 1289}, {0xf8ebad2b84e0d58bL, 1292},
-    {0x9b934c3b330c8577L, 1296}, {0xc2781f49ffcfa6d5L, 1299},
-    {0xf316271c7fc3908aL, 1302}, {0x97edd871cfda3a56L, 1306},
-    {0xbde94e8e43d0c8ecL, 1309}, {0xed63a231d4c4fb27L, 1312},
-    {0x945e455f24fb1cf8L, 1316}, {0xb975d6b6ee39e436L, 1319},
-    {0xe7d34c64a9c85d44L, 1322}, {0x90e40fbeea1d3a4aL, 1326},
-    {0xb51d13aea4a488ddL, 1329}, {0xe264589a4dcdab14L, 1332},
-    {0x8d7eb76070a08aecL, 1336}, {0xb0de65388cc8ada8L, 1339},
-    {0xdd15fe86affad912L, 1342}, {0x8a2dbf142dfcc7abL, 1346},
-    {0xacb92ed9397bf996L, 1349}, {0xd7e77a8f87daf7fbL, 1352},
-    {0x86f0ac99b4e8dafdL, 1356}, {0xa8acd7c0222311bcL, 1359},
-    {0xd2d80db02aabd62bL, 1362}, {0x83c7088e1aab65dbL, 1366},
-    {0xa4b8cab1a1563f52L, 1369}, {0xcde6fd5e09abcf26L, 1372},
-    {0x80b05e5ac60b6178L, 1376}, {0xa0dc75f1778e39d6L, 1379},
-    {0xc913936dd571c84cL, 1382}, {0xfb5878494ace3a5fL, 1385},
-    {0x9d174b2dcec0e47bL, 1389}, {0xc45d1df942711d9aL, 1392},
-    {0xf5746577930d6500L, 1395}, {0x9968bf6abbe85f20L, 1399},
-    {0xbfc2ef456ae276e8L, 1402}, {0xefb3ab16c59b14a2L, 1405},
-    {0x95d04aee3b80ece5L, 1409}, {0xbb445da9ca61281fL, 1412},
-    {0xea1575143cf97226L, 1415}, {0x924d692ca61be758L, 1419},
-    {0xb6e0c377cfa2e12eL, 1422}, {0xe498f455c38b997aL, 1425},
-    {0x8edf98b59a373fecL, 1429}, {0xb2977ee300c50fe7L, 1432},
-    {0xdf3d5e9bc0f653e1L, 1435}, {0x8b865b215899f46cL, 1439},
-    {0xae67f1e9aec07187L, 1442}, {0xda01ee641a708de9L, 1445},
-    {0x884134fe908658b2L, 1449}, {0xaa51823e34a7eedeL, 1452},
-    {0xd4e5e2cdc1d1ea96L, 1455}, {0x850fadc09923329eL, 1459},
-    {0xa6539930bf6bff45L, 1462}, {0xcfe87f7cef46ff16L, 1465},
-    {0x81f14fae158c5f6eL, 1469}, {0xa26da3999aef7749L, 1472},
-    {0xcb090c8001ab551cL, 1475}, {0xfdcb4fa002162a63L, 1478},
-    {0x9e9f11c4014dda7eL, 1482}, {0xc646d63501a1511dL, 1485},
-    {0xf7d88bc24209a565L, 1488}, {0x9ae757596946075fL, 1492},
-    {0xc1a12d2fc3978937L, 1495}, {0xf209787bb47d6b84L, 1498},
-    {0x9745eb4d50ce6332L, 1502}, {0xbd176620a501fbffL, 1505},
-    {0xec5d3fa8ce427affL, 1508}, {0x93ba47c980e98cdfL, 1512},
-    {0xb8a8d9bbe123f017L, 1515}, {0xe6d3102ad96cec1dL, 1518},
-    {0x9043ea1ac7e41392L, 1522}, {0xb454e4a179dd1877L, 1525},
-    {0xe16a1dc9d8545e94L, 1528}, {0x8ce2529e2734bb1dL, 1532},
-    {0xb01ae745b101e9e4L, 1535}, {0xdc21a1171d42645dL, 1538},
-    {0x899504ae72497ebaL, 1542}, {0xabfa45da0edbde69L, 1545},
-    {0xd6f8d7509292d603L, 1548}, {0x865b86925b9bc5c2L, 1552},
-    {0xa7f26836f282b732L, 1555}, {0xd1ef0244af2364ffL, 1558},
-    {0x8335616aed761f1fL, 1562}, {0xa402b9c5a8d3a6e7L, 1565},
-    {0xcd036837130890a1L, 1568}, {0x802221226be55a64L, 1572},
-    {0xa02aa96b06deb0fdL, 1575}, {0xc83553c5c8965d3dL, 1578},
-    {0xfa42a8b73abbf48cL, 1581}, {0x9c69a97284b578d7L, 1585},
-    {0xc38413cf25e2d70dL, 1588}, {0xf46518c2ef5b8cd1L, 1591},
-    {0x98bf2f79d5993802L, 1595}, {0xbeeefb584aff8603L, 1598},
-    {0xeeaaba2e5dbf6784L, 1601}, {0x952ab45cfa97a0b2L, 1605},
-    {0xba756174393d88dfL, 1608}, {0xe912b9d1478ceb17L, 1611},
-    {0x91abb422ccb812eeL, 1615}, {0xb616a12b7fe617aaL, 1618},
-    {0xe39c49765fdf9d94L, 1621}, {0x8e41ade9fbebc27dL, 1625},
-    {0xb1d219647ae6b31cL, 1628}, {0xde469fbd99a05fe3L, 1631},
-    {0x8aec23d680043beeL, 1635}, {0xada72ccc20054ae9L, 1638},
-    {0xd910f7ff28069da4L, 1641}, {0x87aa9aff79042286L, 1645},
-    {0xa99541bf57452b28L, 1648}, {0xd3fa922f2d1675f2L, 1651},
-    {0x847c9b5d7c2e09b7L, 1655}, {0xa59bc234db398c25L, 1658},
-    {0xcf02b2c21207ef2eL, 1661}, {0x8161afb94b44f57dL, 1665},
-    {0xa1ba1ba79e1632dcL, 1668}, {0xca28a291859bbf93L, 1671},
-    {0xfcb2cb35e702af78L, 1674}, {0x9defbf01b061adabL, 1678},
-    {0xc56baec21c7a1916L, 1681}, {0xf6c69a72a3989f5bL, 1684},
-    {0x9a3c2087a63f6399L, 1688}, {0xc0cb28a98fcf3c7fL, 1691},
-    {0xf0fdf2d3f3c30b9fL, 1694}, {0x969eb7c47859e743L, 1698},
-    {0xbc4665b596706114L, 1701}, {0xeb57ff22fc0c7959L, 1704},
-    {0x9316ff75dd87cbd8L, 1708}, {0xb7dcbf5354e9beceL, 1711},
-    {0xe5d3ef282a242e81L, 1714}, {0x8fa475791a569d10L, 1718},
-    {0xb38d92d760ec4455L, 1721}, {0xe070f78d3927556aL, 1724},
-    {0x8c469ab843b89562L, 1728}, {0xaf58416654a6babbL, 1731},
-    {0xdb2e51bfe9d0696aL, 1734}, {0x88fcf317f22241e2L, 1738},
-    {0xab3c2fddeeaad25aL, 1741}, {0xd60b3bd56a5586f1L, 1744},
-    {0x85c7056562757456L, 1748}, {0xa738c6bebb12d16cL, 1751},
-    {0xd106f86e69d785c7L, 1754}, {0x82a45b450226b39cL, 1758},
-    {0xa34d721642b06084L, 1761}, {0xcc20ce9bd35c78a5L, 1764},
-    {0xff290242c83396ceL, 1767}, {0x9f79a169bd203e41L, 1771},
-    {0xc75809c42c684dd1L, 1774}, {0xf92e0c3537826145L, 1777},
-    {0x9bbcc7a142b17ccbL, 1781}, {0xc2abf989935ddbfeL, 1784},
-    {0xf356f7ebf83552feL, 1787}, {0x98165af37b2153deL, 1791},
-    {0xbe1bf1b059e9a8d6L, 1794}, {0xeda2ee1c7064130cL, 1797},
-    {0x9485d4d1c63e8be7L, 1801}, {0xb9a74a0637ce2ee1L, 1804},
-    {0xe8111c87c5c1ba99L, 1807}, {0x910ab1d4db9914a0L, 1811},
-    {0xb54d5e4a127f59c8L, 1814}, {0xe2a0b5dc971f303aL, 1817},
-    {0x8da471a9de737e24L, 1821}, {0xb10d8e1456105dadL, 1824},
-    {0xdd50f1996b947518L, 1827}, {0x8a5296ffe33cc92fL, 1831},
-    {0xace73cbfdc0bfb7bL, 1834}, {0xd8210befd30efa5aL, 1837},
-    {0x8714a775e3e95c78L, 1841}, {0xa8d9d1535ce3b396L, 1844},
-    {0xd31045a8341ca07cL, 1847}, {0x83ea2b892091e44dL, 1851},
-    {0xa4e4b66b68b65d60L, 1854}, {0xce1de40642e3f4b9L, 1857},
-    {0x80d2ae83e9ce78f3L, 1861}, {0xa1075a24e4421730L, 1864},
-    {0xc94930ae1d529cfcL, 1867}, {0xfb9b7cd9a4a7443cL, 1870},
-    {0x9d412e0806e88aa5L, 1874}, {0xc491798a08a2ad4eL, 1877},
-    {0xf5b5d7ec8acb58a2L, 1880}, {0x9991a6f3d6bf1765L, 1884},
-    {0xbff610b0cc6edd3fL, 1887}, {0xeff394dcff8a948eL, 1890},
-    {0x95f83d0a1fb69cd9L, 1894}, {0xbb764c4ca7a4440fL, 1897},
-    {0xea53df5fd18d5513L, 1900}, {0x92746b9be2f8552cL, 1904},
-    {0xb7118682dbb66a77L, 1907}, {0xe4d5e82392a40515L, 1910},
-    {0x8f05b1163ba6832dL, 1914}, {0xb2c71d5bca9023f8L, 1917},
-    {0xdf78e4b2bd342cf6L, 1920}, {0x8bab8eefb6409c1aL, 1924},
-    {0xae9672aba3d0c320L, 1927}, {0xda3c0f568cc4f3e8L, 1930},
-    {0x8865899617fb1871L, 1934}, {0xaa7eebfb9df9de8dL, 1937},
-    {0xd51ea6fa85785631L, 1940}, {0x8533285c936b35deL, 1944},
-    {0xa67ff273b8460356L, 1947}, {0xd01fef10a657842cL, 1950},
-    {0x8213f56a67f6b29bL, 1954}, {0xa298f2c501f45f42L, 1957},
-    {0xcb3f2f7642717713L, 1960}, {0xfe0efb53d30dd4d7L, 1963},
-    {0x9ec95d1463e8a506L, 1967}, {0xc67bb4597ce2ce48L, 1970},
-    {0xf81aa16fdc1b81daL, 1973}, {0x9b10a4e5e9913128L, 1977},
-    {0xc1d4ce1f63f57d72L, 1980}, {0xf24a01a73cf2dccfL, 1983},
-    {0x976e41088617ca01L, 1987}, {0xbd49d14aa79dbc82L, 1990},
-    {0xec9c459d51852ba2L, 1993}, {0x93e1ab8252f33b45L, 1997},
-    {0xb8da1662e7b00a17L, 2000}, {0xe7109bfba19c0c9dL, 2003},
-    {0x906a617d450187e2L, 2007}, {0xb484f9dc9641e9daL, 2010},
-    {0xe1a63853bbd26451L, 2013}, {0x8d07e33455637eb2L, 2017},
-    {0xb049dc016abc5e5fL, 2020}, {0xdc5c5301c56b75f7L, 2023},
-    {0x89b9b3e11b6329baL, 2027}, {0xac2820d9623bf429L, 2030},
-    {0xd732290fbacaf133L, 2033}, {0x867f59a9d4bed6c0L, 2037},
-    {0xa81f301449ee8c70L, 2040}, {0xd226fc195c6a2f8cL, 2043},
-    {0x83585d8fd9c25db7L, 2047}, {0xa42e74f3d032f525L, 2050},
-    {0xcd3a1230c43fb26fL, 2053}, {0x80444b5e7aa7cf85L, 2057},
-    {0xa0555e361951c366L, 2060}, {0xc86ab5c39fa63440L, 2063},
-    {0xfa856334878fc150L, 2066}, {0x9c935e00d4b9d8d2L, 2070},
-    {0xc3b8358109e84f07L, 2073}, {0xf4a642e14c6262c8L, 2076},
-    {0x98e7e9cccfbd7dbdL, 2080}, {0xbf21e44003acdd2cL, 2083},
-    {0xeeea5d5004981478L, 2086}, {0x95527a5202df0ccbL, 2090},
-    {0xbaa718e68396cffdL, 2093}, {0xe950df20247c83fdL, 2096},
-    {0x91d28b7416cdd27eL, 2100}, {0xb6472e511c81471dL, 2103},
-    {0xe3d8f9e563a198e5L, 2106}, {0x8e679c2f5e44ff8fL, 2110}};
-
-// A complement from power_of_ten_components
-// complete to a 128-bit mantissa.
-const uint64_t mantissa_128[] = {0x419ea3bd35385e2d,
-                                 0x52064cac828675b9,
-                                 0x7343efebd1940993,
-                                 0x1014ebe6c5f90bf8,
-                                 0xd41a26e077774ef6,
-                                 0x8920b098955522b4,
-                                 0x55b46e5f5d5535b0,
-                                 0xeb2189f734aa831d,
-                                 0xa5e9ec7501d523e4,
-                                 0x47b233c92125366e,
-                                 0x999ec0bb696e840a,
-                                 0xc00670ea43ca250d,
-                                 0x380406926a5e5728,
-                                 0xc605083704f5ecf2,
-                                 0xf7864a44c633682e,
-                                 0x7ab3ee6afbe0211d,
-                                 0x5960ea05bad82964,
-                                 0x6fb92487298e33bd,
-                                 0xa5d3b6d479f8e056,
-                                 0x8f48a4899877186c,
-                                 0x331acdabfe94de87,
-                                 0x9ff0c08b7f1d0b14,
-                                 0x7ecf0ae5ee44dd9,
-                                 0xc9e82cd9f69d6150,
-                                 0xbe311c083a225cd2,
-                                 0x6dbd630a48aaf406,
-                                 0x92cbbccdad5b108,
-                                 0x25bbf56008c58ea5,
-                                 0xaf2af2b80af6f24e,
-                                 0x1af5af660db4aee1,
-                                 0x50d98d9fc890ed4d,
-                                 0xe50ff107bab528a0,
-                                 0x1e53ed49a96272c8,
-                                 0x25e8e89c13bb0f7a,
-                                 0x77b191618c54e9ac,
-                                 0xd59df5b9ef6a2417,
-                                 0x4b0573286b44ad1d,
-                                 0x4ee367f9430aec32,
-                                 0x229c41f793cda73f,
-                                 0x6b43527578c1110f,
-                                 0x830a13896b78aaa9,
-                                 0x23cc986bc656d553,
-                                 0x2cbfbe86b7ec8aa8,
-                                 0x7bf7d71432f3d6a9,
-                                 0xdaf5ccd93fb0cc53,
-                                 0xd1b3400f8f9cff68,
-                                 0x23100809b9c21fa1,
-                                 0xabd40a0c2832a78a,
-                                 0x16c90c8f323f516c,
-                                 0xae3da7d97f6792e3,
-                                 0x99cd11cfdf41779c,
-                                 0x40405643d711d583,
-                                 0x482835ea666b2572,
-                                 0xda3243650005eecf,
-                                 0x90bed43e40076a82,
-                                 0x5a7744a6e804a291,
-                                 0x711515d0a205cb36,
-                                 0xd5a5b44ca873e03,
-                                 0xe858790afe9486c2,
-                                 0x626e974dbe39a872,
-                                 0xfb0a3d212dc8128f,
-                                 0x7ce66634bc9d0b99,
-                                 0x1c1fffc1ebc44e80,
-                                 0xa327ffb266b56220,
-                                 0x4bf1ff9f0062baa8,
-                                 0x6f773fc3603db4a9,
-                                 0xcb550fb4384d21d3,
-                                 0x7e2a53a146606a48,
-                                 0x2eda7444cbfc426d,
-                                 0xfa911155fefb5308,
-                                 0x793555ab7eba27ca,
-                                 0x4bc1558b2f3458de,
-                                 0x9eb1aaedfb016f16,
-                                 0x465e15a979c1cadc,
-                                 0xbfacd89ec191ec9,
-                                 0xcef980ec671f667b,
-                                 0x82b7e12780e7401a,
-                                 0xd1b2ecb8b0908810,
-                                 0x861fa7e6dcb4aa15,
-                                 0x67a791e093e1d49a,
-                                 0xe0c8bb2c5c6d24e0,
-                                 0x58fae9f773886e18,
-                                 0xaf39a475506a899e,
-                                 0x6d8406c952429603,
-                                 0xc8e5087ba6d33b83,
-                                 0xfb1e4a9a90880a64,
-                                 0x5cf2eea09a55067f,
-                                 0xf42faa48c0ea481e,
-                                 0xf13b94daf124da26,
-                                 0x76c53d08d6b70858,
-                                 0x54768c4b0c64ca6e,
-                                 0xa9942f5dcf7dfd09,
-                                 0xd3f93b35435d7c4c,
-                                 0xc47bc5014a1a6daf,
-                                 0x359ab6419ca1091b,
-                                 0xc30163d203c94b62,
-                                 0x79e0de63425dcf1d,
-                                 0x985915fc12f542e4,
-                                 0x3e6f5b7b17b2939d,
-                                 0xa705992ceecf9c42,
-                                 0x50c6ff782a838353,
-                                 0xa4f8bf5635246428,
-                                 0x871b7795e136be99,
-                                 0x28e2557b59846e3f,
-                                 0x331aeada2fe589cf,
-                                 0x3ff0d2c85def7621,
-                                 0xfed077a756b53a9,
-                                 0xd3e8495912c62894,
-                                 0x64712dd7abbbd95c,
-                                 0xbd8d794d96aacfb3,
-                                 0xecf0d7a0fc5583a0,
-                                 0xf41686c49db57244,
-                                 0x311c2875c522ced5,
-                                 0x7d633293366b828b,
-                                 0xae5dff9c02033197,
-                                 0xd9f57f830283fdfc,
-                                 0xd072df63c324fd7b,
-                                 0x4247cb9e59f71e6d,
-                                 0x52d9be85f074e608,
-                                 0x67902e276c921f8b,
-                                 0xba1cd8a3db53b6,
-                                 0x80e8a40eccd228a4,
-                                 0x6122cd128006b2cd,
-                                 0x796b805720085f81,
-                                 0xcbe3303674053bb0,
-                                 0xbedbfc4411068a9c,
-                                 0xee92fb5515482d44,
-                                 0x751bdd152d4d1c4a,
-                                 0xd262d45a78a0635d,
-                                 0x86fb897116c87c34,
-                                 0xd45d35e6ae3d4da0,
-                                 0x8974836059cca109,
-                                 0x2bd1a438703fc94b,
-                                 0x7b6306a34627ddcf,
-                                 0x1a3bc84c17b1d542,
-                                 0x20caba5f1d9e4a93,
-                                 0x547eb47b7282ee9c,
-                                 0xe99e619a4f23aa43,
-                                 0x6405fa00e2ec94d4,
-                                 0xde83bc408dd3dd04,
-                                 0x9624ab50b148d445,
-                                 0x3badd624dd9b0957,
-                                 0xe54ca5d70a80e5d6,
-                                 0x5e9fcf4ccd211f4c,
-                                 0x7647c3200069671f,
-                                 0x29ecd9f40041e073,
-                                 0xf468107100525890,
-                                 0x7182148d4066eeb4,
-                                 0xc6f14cd848405530,
-                                 0xb8ada00e5a506a7c,
-                                 0xa6d90811f0e4851c,
-                                 0x908f4a166d1da663,
-                                 0x9a598e4e043287fe,
-                                 0x40eff1e1853f29fd,
-                                 0xd12bee59e68ef47c,
-                                 0x82bb74f8301958ce,
-                                 0xe36a52363c1faf01,
-                                 0xdc44e6c3cb279ac1,
-                                 0x29ab103a5ef8c0b9,
-                                 0x7415d448f6b6f0e7,
-                                 0x111b495b3464ad21,
-                                 0xcab10dd900beec34,
-                                 0x3d5d514f40eea742,
-                                 0xcb4a5a3112a5112,
-                                 0x47f0e785eaba72ab,
-                                 0x59ed216765690f56,
-                                 0x306869c13ec3532c,
-                                 0x1e414218c73a13fb,
-                                 0xe5d1929ef90898fa,
-                                 0xdf45f746b74abf39,
-                                 0x6b8bba8c328eb783,
-                                 0x66ea92f3f326564,
-                                 0xc80a537b0efefebd,
-                                 0xbd06742ce95f5f36,
-                                 0x2c48113823b73704,
-                                 0xf75a15862ca504c5,
-                                 0x9a984d73dbe722fb,
-                                 0xc13e60d0d2e0ebba,
-                                 0x318df905079926a8,
-                                 0xfdf17746497f7052,
-                                 0xfeb6ea8bedefa633,
-                                 0xfe64a52ee96b8fc0,
-                                 0x3dfdce7aa3c673b0,
-                                 0x6bea10ca65c084e,
-                                 0x486e494fcff30a62,
-                                 0x5a89dba3c3efccfa,
-                                 0xf89629465a75e01c,
-                                 0xf6bbb397f1135823,
-                                 0x746aa07ded582e2c,
-                                 0xa8c2a44eb4571cdc,
-                                 0x92f34d62616ce413,
-                                 0x77b020baf9c81d17,
-                                 0xace1474dc1d122e,
-                                 0xd819992132456ba,
-                                 0x10e1fff697ed6c69,
-                                 0xca8d3ffa1ef463c1,
-                                 0xbd308ff8a6b17cb2,
-                                 0xac7cb3f6d05ddbde,
-                                 0x6bcdf07a423aa96b,
-                                 0x86c16c98d2c953c6,
-                                 0xe871c7bf077ba8b7,
-                                 0x11471cd764ad4972,
-                                 0xd598e40d3dd89bcf,
-                                 0x4aff1d108d4ec2c3,
-                                 0xcedf722a585139ba,
-                                 0xc2974eb4ee658828,
-                                 0x733d226229feea32,
-                                 0x806357d5a3f525f,
-                                 0xca07c2dcb0cf26f7,
-                                 0xfc89b393dd02f0b5,
-                                 0xbbac2078d443ace2,
-                                 0xd54b944b84aa4c0d,
-                                 0xa9e795e65d4df11,
-                                 0x4d4617b5ff4a16d5,
-                                 0x504bced1bf8e4e45,
-                                 0xe45ec2862f71e1d6,
-                                 0x5d767327bb4e5a4c,
-                                 0x3a6a07f8d510f86f,
-                                 0x890489f70a55368b,
-                                 0x2b45ac74ccea842e,
-                                 0x3b0b8bc90012929d,
-                                 0x9ce6ebb40173744,
-                                 0xcc420a6a101d0515,
-                                 0x9fa946824a12232d,
-                                 0x47939822dc96abf9,
-                                 0x59787e2b93bc56f7,
-                                 0x57eb4edb3c55b65a,
-                                 0xede622920b6b23f1,
-                                 0xe95fab368e45eced,
-                                 0x11dbcb0218ebb414,
-                                 0xd652bdc29f26a119,
-                                 0x4be76d3346f0495f,
-                                 0x6f70a4400c562ddb,
-                                 0xcb4ccd500f6bb952,
-                                 0x7e2000a41346a7a7,
-                                 0x8ed400668c0c28c8,
-                                 0x728900802f0f32fa,
-                                 0x4f2b40a03ad2ffb9,
-                                 0xe2f610c84987bfa8,
-                                 0xdd9ca7d2df4d7c9,
-                                 0x91503d1c79720dbb,
-                                 0x75a44c6397ce912a,
-                                 0xc986afbe3ee11aba,
-                                 0xfbe85badce996168,
-                                 0xfae27299423fb9c3,
-                                 0xdccd879fc967d41a,
-                                 0x5400e987bbc1c920,
-                                 0x290123e9aab23b68,
-                                 0xf9a0b6720aaf6521,
-                                 0xf808e40e8d5b3e69,
-                                 0xb60b1d1230b20e04,
-                                 0xb1c6f22b5e6f48c2,
-                                 0x1e38aeb6360b1af3,
-                                 0x25c6da63c38de1b0,
-                                 0x579c487e5a38ad0e,
-                                 0x2d835a9df0c6d851,
-                                 0xf8e431456cf88e65,
-                                 0x1b8e9ecb641b58ff,
-                                 0xe272467e3d222f3f,
-                                 0x5b0ed81dcc6abb0f,
-                                 0x98e947129fc2b4e9,
-                                 0x3f2398d747b36224,
-                                 0x8eec7f0d19a03aad,
-                                 0x1953cf68300424ac,
-                                 0x5fa8c3423c052dd7,
-                                 0x3792f412cb06794d,
-                                 0xe2bbd88bbee40bd0,
-                                 0x5b6aceaeae9d0ec4,
-                                 0xf245825a5a445275,
-                                 0xeed6e2f0f0d56712,
-                                 0x55464dd69685606b,
-                                 0xaa97e14c3c26b886,
-                                 0xd53dd99f4b3066a8,
-                                 0xe546a8038efe4029,
-                                 0xde98520472bdd033,
-                                 0x963e66858f6d4440,
-                                 0xdde7001379a44aa8,
-                                 0x5560c018580d5d52,
-                                 0xaab8f01e6e10b4a6,
-                                 0xcab3961304ca70e8,
-                                 0x3d607b97c5fd0d22,
-                                 0x8cb89a7db77c506a,
-                                 0x77f3608e92adb242,
-                                 0x55f038b237591ed3,
-                                 0x6b6c46dec52f6688,
-                                 0x2323ac4b3b3da015,
-                                 0xabec975e0a0d081a,
-                                 0x96e7bd358c904a21,
-                                 0x7e50d64177da2e54,
-                                 0xdde50bd1d5d0b9e9,
-                                 0x955e4ec64b44e864,
-                                 0xbd5af13bef0b113e,
-                                 0xecb1ad8aeacdd58e,
-                                 0x67de18eda5814af2,
-                                 0x80eacf948770ced7,
-                                 0xa1258379a94d028d,
-                                 0x96ee45813a04330,
-                                 0x8bca9d6e188853fc,
-                                 0x775ea264cf55347d,
-                                 0x95364afe032a819d,
-                                 0x3a83ddbd83f52204,
-                                 0xc4926a9672793542,
-                                 0x75b7053c0f178293,
-                                 0x5324c68b12dd6338,
-                                 0xd3f6fc16ebca5e03,
-                                 0x88f4bb1ca6bcf584,
-                                 0x2b31e9e3d06c32e5,
-                                 0x3aff322e62439fcf,
-                                 0x9befeb9fad487c2,
-                                 0x4c2ebe687989a9b3,
-                                 0xf9d37014bf60a10,
-                                 0x538484c19ef38c94,
-                                 0x2865a5f206b06fb9,
-                                 0xf93f87b7442e45d3,
-                                 0xf78f69a51539d748,
-                                 0xb573440e5a884d1b,
-                                 0x31680a88f8953030,
-                                 0xfdc20d2b36ba7c3d,
-                                 0x3d32907604691b4c,
-                                 0xa63f9a49c2c1b10f,
-                                 0xfcf80dc33721d53,
-                                 0xd3c36113404ea4a8,
-                                 0x645a1cac083126e9,
-                                 0x3d70a3d70a3d70a3,
-                                 0xcccccccccccccccc,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x0,
-                                 0x4000000000000000,
-                                 0x5000000000000000,
-                                 0xa400000000000000,
-                                 0x4d00000000000000,
-                                 0xf020000000000000,
-                                 0x6c28000000000000,
-                                 0xc732000000000000,
-                                 0x3c7f400000000000,
-                                 0x4b9f100000000000,
-                                 0x1e86d40000000000,
-                                 0x1314448000000000,
-                                 0x17d955a000000000,
-                                 0x5dcfab0800000000,
-                                 0x5aa1cae500000000,
-                                 0xf14a3d9e40000000,
-                                 0x6d9ccd05d0000000,
-                                 0xe4820023a2000000,
-                                 0xdda2802c8a800000,
-                                 0xd50b2037ad200000,
-                                 0x4526f422cc340000,
-                                 0x9670b12b7f410000,
-                                 0x3c0cdd765f114000,
-                                 0xa5880a69fb6ac800,
-                                 0x8eea0d047a457a00,
-                                 0x72a4904598d6d880,
-                                 0x47a6da2b7f864750,
-                                 0x999090b65f67d924,
-                                 0xfff4b4e3f741cf6d,
-                                 0xbff8f10e7a8921a4,
-                                 0xaff72d52192b6a0d,
-                                 0x9bf4f8a69f764490,
-                                 0x2f236d04753d5b4,
-                                 0x1d762422c946590,
-                                 0x424d3ad2b7b97ef5,
-                                 0xd2e0898765a7deb2,
-                                 0x63cc55f49f88eb2f,
-                                 0x3cbf6b71c76b25fb,
-                                 0x8bef464e3945ef7a,
-                                 0x97758bf0e3cbb5ac,
-                                 0x3d52eeed1cbea317,
-                                 0x4ca7aaa863ee4bdd,
-                                 0x8fe8caa93e74ef6a,
-                                 0xb3e2fd538e122b44,
-                                 0x60dbbca87196b616,
-                                 0xbc8955e946fe31cd,
-                                 0x6babab6398bdbe41,
-                                 0xc696963c7eed2dd1,
-                                 0xfc1e1de5cf543ca2,
-                                 0x3b25a55f43294bcb,
-                                 0x49ef0eb713f39ebe,
-                                 0x6e3569326c784337,
-                                 0x49c2c37f07965404,
-                                 0xdc33745ec97be906,
-                                 0x69a028bb3ded71a3,
-                                 0xc40832ea0d68ce0c,
-                                 0xf50a3fa490c30190,
-                                 0x792667c6da79e0fa,
-                                 0x577001b891185938,
-                                 0xed4c0226b55e6f86,
-                                 0x544f8158315b05b4,
-                                 0x696361ae3db1c721,
-                                 0x3bc3a19cd1e38e9,
-                                 0x4ab48a04065c723,
-                                 0x62eb0d64283f9c76,
-                                 0x3ba5d0bd324f8394,
-                                 0xca8f44ec7ee36479,
-                                 0x7e998b13cf4e1ecb,
-                                 0x9e3fedd8c321a67e,
-                                 0xc5cfe94ef3ea101e,
-                                 0xbba1f1d158724a12,
-                                 0x2a8a6e45ae8edc97,
-                                 0xf52d09d71a3293bd,
-                                 0x593c2626705f9c56,
-                                 0x6f8b2fb00c77836c,
-                                 0xb6dfb9c0f956447,
-                                 0x4724bd4189bd5eac,
-                                 0x58edec91ec2cb657,
-                                 0x2f2967b66737e3ed,
-                                 0xbd79e0d20082ee74,
-                                 0xecd8590680a3aa11,
-                                 0xe80e6f4820cc9495,
-                                 0x3109058d147fdcdd,
-                                 0xbd4b46f0599fd415,
-                                 0x6c9e18ac7007c91a,
-                                 0x3e2cf6bc604ddb0,
-                                 0x84db8346b786151c,
-                                 0xe612641865679a63,
-                                 0x4fcb7e8f3f60c07e,
-                                 0xe3be5e330f38f09d,
-                                 0x5cadf5bfd3072cc5,
-                                 0x73d9732fc7c8f7f6,
-                                 0x2867e7fddcdd9afa,
-                                 0xb281e1fd541501b8,
-                                 0x1f225a7ca91a4226,
-                                 0x3375788de9b06958,
-                                 0x52d6b1641c83ae,
-                                 0xc0678c5dbd23a49a,
-                                 0xf840b7ba963646e0,
-                                 0xb650e5a93bc3d898,
-                                 0xa3e51f138ab4cebe,
-                                 0xc66f336c36b10137,
-                                 0xb80b0047445d4184,
-                                 0xa60dc059157491e5,
-                                 0x87c89837ad68db2f,
-                                 0x29babe4598c311fb,
-                                 0xf4296dd6fef3d67a,
-                                 0x1899e4a65f58660c,
-                                 0x5ec05dcff72e7f8f,
-                                 0x76707543f4fa1f73,
-                                 0x6a06494a791c53a8,
-                                 0x487db9d17636892,
-                                 0x45a9d2845d3c42b6,
-                                 0xb8a2392ba45a9b2,
-                                 0x8e6cac7768d7141e,
-                                 0x3207d795430cd926,
-                                 0x7f44e6bd49e807b8,
-                                 0x5f16206c9c6209a6,
-                                 0x36dba887c37a8c0f,
-                                 0xc2494954da2c9789,
-                                 0xf2db9baa10b7bd6c,
-                                 0x6f92829494e5acc7,
-                                 0xcb772339ba1f17f9,
-                                 0xff2a760414536efb,
-                                 0xfef5138519684aba,
-                                 0x7eb258665fc25d69,
-                                 0xef2f773ffbd97a61,
-                                 0xaafb550ffacfd8fa,
-                                 0x95ba2a53f983cf38,
-                                 0xdd945a747bf26183,
-                                 0x94f971119aeef9e4,
-                                 0x7a37cd5601aab85d,
-                                 0xac62e055c10ab33a,
-                                 0x577b986b314d6009,
-                                 0xed5a7e85fda0b80b,
-                                 0x14588f13be847307,
-                                 0x596eb2d8ae258fc8,
-                                 0x6fca5f8ed9aef3bb,
-                                 0x25de7bb9480d5854,
-                                 0xaf561aa79a10ae6a,
-                                 0x1b2ba1518094da04,
-                                 0x90fb44d2f05d0842,
-                                 0x353a1607ac744a53,
-                                 0x42889b8997915ce8,
-                                 0x69956135febada11,
-                                 0x43fab9837e699095,
-                                 0x94f967e45e03f4bb,
-                                 0x1d1be0eebac278f5,
-                                 0x6462d92a69731732,
-                                 0x7d7b8f7503cfdcfe,
-                                 0x5cda735244c3d43e,
-                                 0x3a0888136afa64a7,
-                                 0x88aaa1845b8fdd0,
-                                 0x8aad549e57273d45,
-                                 0x36ac54e2f678864b,
-                                 0x84576a1bb416a7dd,
-                                 0x656d44a2a11c51d5,
-                                 0x9f644ae5a4b1b325,
-                                 0x873d5d9f0dde1fee,
-                                 0xa90cb506d155a7ea,
-                                 0x9a7f12442d588f2,
-                                 0xc11ed6d538aeb2f,
-                                 0x8f1668c8a86da5fa,
-                                 0xf96e017d694487bc,
-                                 0x37c981dcc395a9ac,
-                                 0x85bbe253f47b1417,
-                                 0x93956d7478ccec8e,
-                                 0x387ac8d1970027b2,
-                                 0x6997b05fcc0319e,
-                                 0x441fece3bdf81f03,
-                                 0xd527e81cad7626c3,
-                                 0x8a71e223d8d3b074,
-                                 0xf6872d5667844e49,
-                                 0xb428f8ac016561db,
-                                 0xe13336d701beba52,
-                                 0xecc0024661173473,
-                                 0x27f002d7f95d0190,
-                                 0x31ec038df7b441f4,
-                                 0x7e67047175a15271,
-                                 0xf0062c6e984d386,
-                                 0x52c07b78a3e60868,
-                                 0xa7709a56ccdf8a82,
-                                 0x88a66076400bb691,
-                                 0x6acff893d00ea435,
-                                 0x583f6b8c4124d43,
-                                 0xc3727a337a8b704a,
-                                 0x744f18c0592e4c5c,
-                                 0x1162def06f79df73,
-                                 0x8addcb5645ac2ba8,
-                                 0x6d953e2bd7173692,
-                                 0xc8fa8db6ccdd0437,
-                                 0x1d9c9892400a22a2,
-                                 0x2503beb6d00cab4b,
-                                 0x2e44ae64840fd61d,
-                                 0x5ceaecfed289e5d2,
-                                 0x7425a83e872c5f47,
-                                 0xd12f124e28f77719,
-                                 0x82bd6b70d99aaa6f,
-                                 0x636cc64d1001550b,
-                                 0x3c47f7e05401aa4e,
-                                 0x65acfaec34810a71,
-                                 0x7f1839a741a14d0d,
-                                 0x1ede48111209a050,
-                                 0x934aed0aab460432,
-                                 0xf81da84d5617853f,
-                                 0x36251260ab9d668e,
-                                 0xc1d72b7c6b426019,
-                                 0xb24cf65b8612f81f,
-                                 0xdee033f26797b627,
-                                 0x169840ef017da3b1,
-                                 0x8e1f289560ee864e,
-                                 0xf1a6f2bab92a27e2,
-                                 0xae10af696774b1db,
-                                 0xacca6da1e0a8ef29,
-                                 0x17fd090a58d32af3,
-                                 0xddfc4b4cef07f5b0,
-                                 0x4abdaf101564f98e,
-                                 0x9d6d1ad41abe37f1,
-                                 0x84c86189216dc5ed,
-                                 0x32fd3cf5b4e49bb4,
-                                 0x3fbc8c33221dc2a1,
-                                 0xfabaf3feaa5334a,
-                                 0x29cb4d87f2a7400e,
-                                 0x743e20e9ef511012,
-                                 0x914da9246b255416,
-                                 0x1ad089b6c2f7548e,
-                                 0xa184ac2473b529b1,
-                                 0xc9e5d72d90a2741e,
-                                 0x7e2fa67c7a658892,
-                                 0xddbb901b98feeab7,
-                                 0x552a74227f3ea565,
-                                 0xd53a88958f87275f,
-                                 0x8a892abaf368f137,
-                                 0x2d2b7569b0432d85,
-                                 0x9c3b29620e29fc73,
-                                 0x8349f3ba91b47b8f,
-                                 0x241c70a936219a73,
-                                 0xed238cd383aa0110,
-                                 0xf4363804324a40aa,
-                                 0xb143c6053edcd0d5,
-                                 0xdd94b7868e94050a,
-                                 0xca7cf2b4191c8326,
-                                 0xfd1c2f611f63a3f0,
-                                 0xbc633b39673c8cec,
-                                 0xd5be0503e085d813,
-                                 0x4b2d8644d8a74e18,
-                                 0xddf8e7d60ed1219e,
-                                 0xcabb90e5c942b503,
-                                 0x3d6a751f3b936243,
-                                 0xcc512670a783ad4,
-                                 0x27fb2b80668b24c5,
-                                 0xb1f9f660802dedf6,
-                                 0x5e7873f8a0396973,
-                                 0xdb0b487b6423e1e8,
-                                 0x91ce1a9a3d2cda62,
-                                 0x7641a140cc7810fb,
-                                 0xa9e904c87fcb0a9d,
-                                 0x546345fa9fbdcd44,
-                                 0xa97c177947ad4095,
-                                 0x49ed8eabcccc485d,
-                                 0x5c68f256bfff5a74,
-                                 0x73832eec6fff3111,
-                                 0xc831fd53c5ff7eab,
-                                 0xba3e7ca8b77f5e55,
-                                 0x28ce1bd2e55f35eb,
-                                 0x7980d163cf5b81b3,
-                                 0xd7e105bcc332621f,
-                                 0x8dd9472bf3fefaa7,
-                                 0xb14f98f6f0feb951,
-                                 0x6ed1bf9a569f33d3,
-                                 0xa862f80ec4700c8,
-                                 0xcd27bb612758c0fa,
-                                 0x8038d51cb897789c,
-                                 0xe0470a63e6bd56c3,
-                                 0x1858ccfce06cac74,
-                                 0xf37801e0c43ebc8,
-                                 0xd30560258f54e6ba,
-                                 0x47c6b82ef32a2069,
-                                 0x4cdc331d57fa5441,
-                                 0xe0133fe4adf8e952,
-                                 0x58180fddd97723a6,
-                                 0x570f09eaa7ea7648};
+// In padded mode (see parse_number_padded_base), the input is followed by
+// FAST_DOUBLE_PARSER_PADDING readable characters and ends on a character
+// that stops the number, so the scanner never has to look for pend.
+#define FAST_DOUBLE_PARSER_PADDING 64
+
+template <bool _Padded, class _Char>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool before_end(const _Char *p, const _Char *pend) {
+  return _Padded || p < pend;
+}
+
+// SWAR (SIMD within a register) helpers: eight ASCII characters are loaded
+// into a single 64-bit word, checked and converted at once.
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 uint64_t read_u64(const char *p) {
+  if (is_constant_evaluated()) {
+    uint64_t val = 0;
+    for (int k = 0; k < 8; k++) {
+      val |= uint64_t(uint8_t(p[k])) << (8 * k);
+    }
+    return val;
+  }
+  uint64_t val;
+  ::memcpy(&val, p, sizeof(uint64_t));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  val = __builtin_bswap64(val);
+#endif
+  return val;
+}
+
+// true if all eight bytes of val are in ['0', '9']
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool is_made_of_eight_digits_fast(uint64_t val) {
+  return !((((val + 0x4646464646464646) | (val - 0x3030303030303030)) &
+            0x8080808080808080));
+}
+
+// converts eight ASCII digits (first digit in the lowest byte) to an integer
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 uint32_t parse_eight_digits_unrolled(uint64_t val) {
+  const uint64_t mask = 0x000000FF000000FF;
+  const uint64_t mul1 = 0x000F424000000064; // 100 + (1000000ULL << 32)
+  const uint64_t mul2 = 0x0000271000000001; // 1 + (10000ULL << 32)
+  val -= 0x3030303030303030;
+  val = (val * 10) + (val >> 8); // val = (val * 2561) >> 8;
+  val = (((val & mask) * mul1) + (((val >> 16) & mask) * mul2)) >> 32;
+  return uint32_t(val);
+}
+
+// Narrows eight wide characters (UTF-16 or UTF-32 code units) into a
+// word laid out like read_u64 would for ASCII. Returns false if one of them
+// does not fit in a byte: it is not a digit then, whatever its low byte says.
+// The units are read a word at a time and their low bytes gathered with
+// shifts; big-endian targets and constant evaluation go one unit at a
+// time.
+template <class _Char>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool narrow_eight_chars_by_unit(const _Char *p, uint64_t &val) {
+  typedef typename std::make_unsigned<_Char>::type _Uchar;
+  _Uchar high = 0;
+  uint64_t v = 0;
+  for (int k = 0; k < 8; k++) {
+    const _Uchar c = _Uchar(p[k]);
+    high |= c;
+    v |= uint64_t(uint8_t(c)) << (8 * k);
+  }
+  val = v;
+  return (high >> 8) == 0;
+}
+
+template <class _Char>
+really_inline bool narrow_eight_chars(const _Char *p, uint64_t &val) {
+  return narrow_eight_chars_by_unit(p, val);
+}
+
+#if !defined(__BYTE_ORDER__) || (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+template <>
+really_inline bool narrow_eight_chars(const char16_t *p, uint64_t &val) {
+  uint64_t w[2];
+  ::memcpy(w, p, sizeof(w));
+  if ((w[0] | w[1]) & 0xFF00FF00FF00FF00) {
+    return false;
+  }
+  for (uint64_t &x : w) { // 0x00dd00cc00bb00aa -> 0xddccbbaa
+    x = (x | (x >> 8)) & 0x0000FFFF0000FFFF;
+    x = (x | (x >> 16)) & 0x00000000FFFFFFFF;
+  }
+  val = w[0] | (w[1] << 32);
+  return true;
+}
+
+template <>
+really_inline bool narrow_eight_chars(const char32_t *p, uint64_t &val) {
+  uint64_t w[4];
+  ::memcpy(w, p, sizeof(w));
+  if ((w[0] | w[1] | w[2] | w[3]) & 0xFFFFFF00FFFFFF00) {
+    return false;
+  }
+  for (uint64_t &x : w) { // 0x000000bb000000aa -> 0xbbaa
+    x = (x | (x >> 24)) & 0xFFFF;
+  }
+  val = w[0] | (w[1] << 16) | (w[2] << 32) | (w[3] << 48);
+  return true;
+}
+
+// wchar_t is one or the other depending on the platform
+template <>
+really_inline bool narrow_eight_chars(const wchar_t *p, uint64_t &val) {
+  typedef std::conditional<sizeof(wchar_t) == 2, char16_t, char32_t>::type _Same;
+  return narrow_eight_chars(reinterpret_cast<const _Same *>(p), val);
+}
+#endif
+
+// Appends the next eight digits at p to i, if there are eight digits
+// before pend (or anywhere, with _Padded). Wide characters are narrowed
+// first, then take the same SWAR route.
+template <bool _Padded = false>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_eight_digits(const char *p, const char *pend, uint64_t &i) {
+  if (!_Padded && pend - p < 8) {
+    return false;
+  }
+  uint64_t val = read_u64(p);
+  if (!is_made_of_eight_digits_fast(val)) {
+    return false;
+  }
+  i = i * 100000000 + parse_eight_digits_unrolled(val);
+  return true;
+}
+
+template <bool _Padded = false, class _Char>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_eight_digits(const _Char *p, const _Char *pend, uint64_t &i) {
+  if (!_Padded && pend - p < 8) {
+    return false;
+  }
+  uint64_t val = 0;
+  if (!(is_constant_evaluated() ? narrow_eight_chars_by_unit(p, val) : narrow_eight_chars(p, val)) ||
+      !is_made_of_eight_digits_fast(val)) {
+    return false;
+  }
+  i = i * 100000000 + parse_eight_digits_unrolled(val);
+  return true;
+}
+
+// 0 to 15 for a hexadecimal digit (either case), 16 or more otherwise
+template <class _Char>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 uint32_t hex_digit_value(_Char c) {
+  uint32_t d = uint32_t(c) - '0';
+  if (d < 10) {
+    return d;
+  }
+  d = (uint32_t(c) | 32) - 'a';
+  return d < 6 ? d + 10 : 16;
+}
+
+// true if all eight bytes of val are in ['0', '9'], ['a', 'f'] or
+// ['A', 'F']. Each byte is tested on its low seven bits, so no carry
+// crosses into the next byte.
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool is_made_of_eight_hex_digits_fast(uint64_t val) {
+  const uint64_t ones = 0x0101010101010101;
+  const uint64_t low = val & (ones * 0x7F);
+  const uint64_t lower = (val | (ones * 0x20)) & (ones * 0x7F);
+  const uint64_t digit = ((ones * (0x7F + '9' + 1)) - low) & (low + ones * (0x80 - '0'));
+  const uint64_t alpha = ((ones * (0x7F + 'f' + 1)) - lower) & (lower + ones * (0x80 - 'a'));
+  return ((digit | alpha) & ~val & (ones * 0x80)) == ones * 0x80;
+}
+
+// converts eight ASCII hex digits (first digit in the lowest byte) to an
+// integer: one nibble per byte, then pairs of nibbles, pairs of bytes and
+// pairs of 16-bit halves are merged, most significant first
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 uint32_t parse_eight_hex_digits_unrolled(uint64_t val) {
+  // '0'-'9' keep their low nibble; letters have bit 6 set and need 9 more
+  val = (val & 0x0F0F0F0F0F0F0F0F) + ((val >> 6) & 0x0101010101010101) * 9;
+  val = ((val & 0x00FF00FF00FF00FF) << 4) | ((val >> 8) & 0x00FF00FF00FF00FF);
+  val = ((val & 0x0000FFFF0000FFFF) << 8) | ((val >> 16) & 0x0000FFFF0000FFFF);
+  return uint32_t(((val & 0xFFFFFFFF) << 16) | (val >> 32));
+}
+
+// Appends the next eight hex digits at p to i, as parse_eight_digits does.
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_eight_hex_digits(const char *p, const char *pend, uint64_t &i) {
+  if (pend - p < 8) {
+    return false;
+  }
+  uint64_t val = read_u64(p);
+  if (!is_made_of_eight_hex_digits_fast(val)) {
+    return false;
+  }
+  i = (i << 32) | parse_eight_hex_digits_unrolled(val);
+  return true;
+}
+
+template <class _Char>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_eight_hex_digits(const _Char *p, const _Char *pend, uint64_t &i) {
+  if (pend - p < 8) {
+    return false;
+  }
+  uint64_t val = 0;
+  if (!(is_constant_evaluated() ? narrow_eight_chars_by_unit(p, val) : narrow_eight_chars(p, val)) ||
+      !is_made_of_eight_hex_digits_fast(val)) {
+    return false;
+  }
+  i = (i << 32) | parse_eight_hex_digits_unrolled(val);
+  return true;
+}
+
+// A fixed-size array that can be returned by a constexpr function. The
+// tables below are generated by constexpr code when the header is
+// compiled (or spelled out, under C++11), and indexed like plain arrays.
+template <class T, int N>
+struct constexpr_array {
+  T value[N];
+
+  constexpr const T &operator[](int64_t i) const { return value[i]; }
+  static constexpr int size() { return N; }
+};
+
+#ifdef FAST_DOUBLE_PARSER_COMPACT_TABLES
+#define FASTFLOAT_DOUBLE_POWERS 23
+#else
+#define FASTFLOAT_DOUBLE_POWERS 309
+#endif
+#define FASTFLOAT_MANTISSA_POWERS (FASTFLOAT_LARGEST_POWER - FASTFLOAT_SMALLEST_POWER + 1)
+
+// floor(log2(10^q)) + 1087: the binary exponent that goes with the
+// mantissa of 10^q in power_of_ten_mantissa_64 (below), with
+// 217706 / 2^16 standing in for log2(10).
+really_inline constexpr int32_t power_of_ten_exponent(int64_t q) {
+  return int32_t((((152170 + 65536) * q) >> 16) + 1024 + 63);
+}
+
+// The compact tables: about 700 bytes instead of 10KB. Every 28th power,
+// 10^b with b = FASTFLOAT_SMALLEST_POWER + 28k, is stored in full, and
+// 10^(b+r) = 10^b * 5^r * 2^r is rebuilt from it with one 128x64 multiply
+// (5^27 still fits in 64 bits). Keeping the top 128 bits of that product
+// loses at most a few units in the low half, so two bits per power record
+// what to add back to get exactly the value in the full tables.
+// FAST_DOUBLE_PARSER_COMPACT_TABLES makes the parsers use them.
+#define FASTFLOAT_COMPACT_POWER_STEP 28
+#define FASTFLOAT_COMPACT_POWER_BASES                                          \
+  ((FASTFLOAT_LARGEST_POWER - FASTFLOAT_SMALLEST_POWER) / FASTFLOAT_COMPACT_POWER_STEP + 1)
+#define FASTFLOAT_COMPACT_POWER_CORRECTION_WORDS                               \
+  ((FASTFLOAT_LARGEST_POWER - FASTFLOAT_SMALLEST_POWER) / 32 + 1)
+
+// The generators below loop and mutate, which constexpr functions may do
+// only since C++14. Under C++11 the same tables come from the literals in
+// the #else branch, printed from the generated ones (make unit11 checks
+// them against strtod and against each other).
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define FAST_DOUBLE_PARSER_GENERATED_TABLES 1
+
+// Exact unsigned integer of up to 30 32-bit limbs, with the few
+// operations the power-of-ten generator needs.
+struct power_generator_bigint {
+  uint32_t limb[30]; // least significant first
+  int size;
+
+  constexpr explicit power_generator_bigint(int power_of_two) : limb(), size(power_of_two / 32 + 1) {
+    limb[power_of_two / 32] = uint32_t(1) << (power_of_two % 32);
+  }
+
+  constexpr power_generator_bigint(uint64_t high, uint64_t low)
+      : limb{uint32_t(low), uint32_t(low >> 32), uint32_t(high), uint32_t(high >> 32)}, size(4) {
+    while (size > 1 && limb[size - 1] == 0) {
+      size--;
+    }
+  }
+
+  constexpr void multiply(uint32_t m) {
+    uint64_t carry = 0;
+    for (int i = 0; i < size; i++) {
+      carry += uint64_t(limb[i]) * m;
+      limb[i] = uint32_t(carry);
+      carry >>= 32;
+    }
+    if (carry != 0) {
+      limb[size++] = uint32_t(carry);
+    }
+  }
+
+  // rounds down
+  constexpr void divide(uint32_t d) {
+    uint64_t rem = 0;
+    for (int i = size - 1; i >= 0; i--) {
+      rem = (rem << 32) | limb[i];
+      limb[i] = uint32_t(rem / d);
+      rem %= d;
+    }
+    while (size > 1 && limb[size - 1] == 0) {
+      size--;
+    }
+  }
+
+  constexpr int bit_length() const {
+    int bits = 32 * (size - 1);
+    for (uint32_t top = limb[size - 1]; top != 0; top >>= 1) {
+      bits++;
+    }
+    return bits;
+  }
+
+  constexpr uint64_t limb_or_zero(int i) const { return i < size ? limb[i] : 0; }
+
+  // the 64 bits from bit `from` up, zeros below bit 0
+  constexpr uint64_t bits_at(int from) const {
+    if (from < 0) {
+      return from <= -64 ? 0 : bits_at(0) << -from;
+    }
+    const int i = from / 32, shift = from % 32;
+    const uint64_t low = limb_or_zero(i) | (limb_or_zero(i + 1) << 32);
+    return shift == 0 ? low : (low >> shift) | (limb_or_zero(i + 2) << (64 - shift));
+  }
+};
+
+// 10^q as a 128-bit mantissa, truncated, with its binary exponent.
+struct power_of_ten_128 {
+  uint64_t high;
+  uint64_t low;
+  int32_t exp;  // floor(log2(10^q)) + 1087, see power_of_ten_exponent
+  bool exact;   // high:low is 10^q with no bits lost
+};
+
+// n is 10^q * 2^scale, rounded down to an integer
+constexpr power_of_ten_128 power_of_ten_from(const power_generator_bigint &n, int scale, bool exact) {
+  const int bits = n.bit_length();
+  return power_of_ten_128{n.bits_at(bits - 64), n.bits_at(bits - 128), int32_t(bits - 1 - scale + 1087),
+                          exact && bits <= 128};
+}
+
+// Every power of ten from 10^Smallest to 10^Largest (-342 <= Smallest <=
+// 0 <= Largest), from exact big integers: 5^q for 10^q = 5^q * 2^q, and
+// floor(2^928 / 5^q) for 10^-q, which is still exact after each division
+// by five since floor(floor(x) / 5) = floor(x / 5). 2^928 is 128 bits
+// more than 5^342.
+template <int Smallest, int Largest>
+constexpr constexpr_array<power_of_ten_128, Largest - Smallest + 1> generate_power_of_ten_table() {
+  constexpr_array<power_of_ten_128, Largest - Smallest + 1> table{};
+  const int scale = 928;
+  power_generator_bigint five(0);
+  power_generator_bigint inverse_five(scale);
+  const int top = -Smallest > Largest ? -Smallest : Largest;
+  for (int q = 0; q <= top; q++) {
+    if (q > 0) {
+      five.multiply(5);
+      inverse_five.divide(5);
+    }
+    if (q <= Largest) {
+      table.value[q - Smallest] = power_of_ten_from(five, -q, true);
+    }
+    if (q > 0 && -q >= Smallest) {
+      table.value[-q - Smallest] = power_of_ten_from(inverse_five, scale + q, false);
+    }
+  }
+  return table;
+}
+
+// The generated powers that the tables below are cut from.
+static constexpr constexpr_array<power_of_ten_128, FASTFLOAT_LARGEST_POWER - FASTFLOAT_SMALLEST_POWER + 1>
+    power_of_ten_table = generate_power_of_ten_table<FASTFLOAT_SMALLEST_POWER, FASTFLOAT_LARGEST_POWER>();
+
+// The low half of the 128-bit mantissa of 10^q. For 10^-27 to 10^-1 the
+// 128-bit value is rounded up rather than truncated, as in fast_float: the
+// error bounds that let compute_float_64 do without a fallback rely on it.
+constexpr uint64_t power_of_ten_low_half(int q) {
+  return power_of_ten_table[q - FASTFLOAT_SMALLEST_POWER].low + (q >= -27 && q <= -1);
+}
+
+template <int Smallest, int Largest>
+constexpr constexpr_array<uint64_t, Largest - Smallest + 1> generate_mantissa_128() {
+  constexpr_array<uint64_t, Largest - Smallest + 1> table{};
+  for (int q = Smallest; q <= Largest; q++) {
+    table.value[q - Smallest] = power_of_ten_low_half(q);
+  }
+  return table;
+}
+
+// The high halves of the 128-bit mantissas, truncated.
+template <int Smallest, int Largest>
+constexpr constexpr_array<uint64_t, Largest - Smallest + 1> generate_power_of_ten_mantissas() {
+  constexpr_array<uint64_t, Largest - Smallest + 1> table{};
+  for (int q = Smallest; q <= Largest; q++) {
+    table.value[q - Smallest] = power_of_ten_table[q - FASTFLOAT_SMALLEST_POWER].high;
+  }
+  return table;
+}
+
+// 10^q rounded to the nearest double, for 10^q in the normal range. The
+// 128 generated bits decide the rounding: past 10^55 they are followed by
+// more nonzero bits, so a halfway pattern rounds up.
+constexpr double power_of_ten_to_double(int q) {
+  const power_of_ten_128 &p = power_of_ten_table[q - FASTFLOAT_SMALLEST_POWER];
+  uint64_t mantissa = p.high >> 11;
+  int exponent = p.exp - 1087 - 52;
+  if (((p.high >> 10) & 1) != 0 &&
+      ((p.high & 0x3ff) != 0 || p.low != 0 || !p.exact || (mantissa & 1) != 0)) {
+    mantissa++;
+  }
+  double d = double(mantissa); // exact, 2^53 included
+  for (; exponent >= 32; exponent -= 32) {
+    d *= 4294967296.0;
+  }
+  for (; exponent <= -32; exponent += 32) {
+    d /= 4294967296.0;
+  }
+  for (; exponent > 0; exponent--) {
+    d *= 2;
+  }
+  for (; exponent < 0; exponent++) {
+    d /= 2;
+  }
+  return d;
+}
+
+// 10^(Sign * k) as doubles, for k from 0 to N - 1
+template <int Sign, int N>
+constexpr constexpr_array<double, N> generate_double_powers_of_ten() {
+  constexpr_array<double, N> table{};
+  for (int k = 0; k < N; k++) {
+    table.value[k] = power_of_ten_to_double(Sign * k);
+  }
+  return table;
+}
+
+constexpr bool power_of_ten_exponents_match() {
+  for (int q = FASTFLOAT_SMALLEST_POWER; q <= FASTFLOAT_LARGEST_POWER; q++) {
+    if (power_of_ten_exponent(q) != power_of_ten_table[q - FASTFLOAT_SMALLEST_POWER].exp) {
+      return false;
+    }
+  }
+  return true;
+}
+static_assert(power_of_ten_exponents_match(), "power_of_ten_exponent is off");
+
+template <bool High>
+constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_BASES> generate_compact_power_of_ten_bases() {
+  constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_BASES> table{};
+  for (int k = 0; k < FASTFLOAT_COMPACT_POWER_BASES; k++) {
+    const int q = FASTFLOAT_SMALLEST_POWER + FASTFLOAT_COMPACT_POWER_STEP * k;
+    table.value[k] = High ? power_of_ten_table[q - FASTFLOAT_SMALLEST_POWER].high : power_of_ten_low_half(q);
+  }
+  return table;
+}
+
+constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_STEP> generate_compact_powers_of_five() {
+  constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_STEP> table{};
+  uint64_t five = 1;
+  for (int r = 0; r < FASTFLOAT_COMPACT_POWER_STEP; r++, five *= 5) {
+    table.value[r] = five;
+  }
+  return table;
+}
+
+// The bits of 10^q that the rebuilt product gets right: the top 128 of
+// (10^b, 128 bits) * 5^r, computed exactly.
+constexpr power_of_ten_128 rebuild_compact_power_of_ten(int q) {
+  const int index = q - FASTFLOAT_SMALLEST_POWER;
+  const int b = q - index % FASTFLOAT_COMPACT_POWER_STEP;
+  power_generator_bigint n(power_of_ten_table[b - FASTFLOAT_SMALLEST_POWER].high, power_of_ten_low_half(b));
+  for (int r = b; r < q; r++) {
+    n.multiply(5);
+  }
+  const int bits = n.bit_length();
+  return power_of_ten_128{n.bits_at(bits - 64), n.bits_at(bits - 128), 0, false};
+}
+
+// Two bits per power: power_of_ten_low_half(q) minus the rebuilt low half.
+constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_CORRECTION_WORDS> generate_compact_power_of_ten_corrections() {
+  constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_CORRECTION_WORDS> table{};
+  for (int q = FASTFLOAT_SMALLEST_POWER; q <= FASTFLOAT_LARGEST_POWER; q++) {
+    const int index = q - FASTFLOAT_SMALLEST_POWER;
+    const uint64_t correction = power_of_ten_low_half(q) - rebuild_compact_power_of_ten(q).low;
+    table.value[index / 32] |= (correction & 3) << (2 * (index % 32));
+  }
+  return table;
+}
+
+constexpr bool compact_power_of_ten_corrections_fit() {
+  for (int q = FASTFLOAT_SMALLEST_POWER; q <= FASTFLOAT_LARGEST_POWER; q++) {
+    const power_of_ten_128 p = rebuild_compact_power_of_ten(q);
+    if (p.high != power_of_ten_table[q - FASTFLOAT_SMALLEST_POWER].high || power_of_ten_low_half(q) - p.low > 3) {
+      return false;
+    }
+  }
+  return true;
+}
+static_assert(compact_power_of_ten_corrections_fit(), "compact power table needs wider corrections");
+
+#else
+#define FAST_DOUBLE_PARSER_GENERATED_TABLES 0
+
+constexpr constexpr_array<double, FASTFLOAT_DOUBLE_POWERS> literal_power_of_ten() {
+  return {{1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+           1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+#ifndef FAST_DOUBLE_PARSER_COMPACT_TABLES
+           , 1e23, 1e24, 1e25, 1e26, 1e27, 1e28, 1e29, 1e30, 1e31, 1e32, 1e33, 1e34,
+           1e35, 1e36, 1e37, 1e38, 1e39, 1e40, 1e41, 1e42, 1e43, 1e44, 1e45, 1e46,
+           1e47, 1e48, 1e49, 1e50, 1e51, 1e52, 1e53, 1e54, 1e55, 1e56, 1e57, 1e58,
+           1e59, 1e60, 1e61, 1e62, 1e63, 1e64, 1e65, 1e66, 1e67, 1e68, 1e69, 1e70,
+           1e71, 1e72, 1e73, 1e74, 1e75, 1e76, 1e77, 1e78, 1e79, 1e80, 1e81, 1e82,
+           1e83, 1e84, 1e85, 1e86, 1e87, 1e88, 1e89, 1e90, 1e91, 1e92, 1e93, 1e94,
+           1e95, 1e96, 1e97, 1e98, 1e99, 1e100, 1e101, 1e102, 1e103, 1e104, 1e105, 1e106,
+           1e107, 1e108, 1e109, 1e110, 1e111, 1e112, 1e113, 1e114, 1e115, 1e116, 1e117, 1e118,
+           1e119, 1e120, 1e121, 1e122, 1e123, 1e124, 1e125, 1e126, 1e127, 1e128, 1e129, 1e130,
+           1e131, 1e132, 1e133, 1e134, 1e135, 1e136, 1e137, 1e138, 1e139, 1e140, 1e141, 1e142,
+           1e143, 1e144, 1e145, 1e146, 1e147, 1e148, 1e149, 1e150, 1e151, 1e152, 1e153, 1e154,
+           1e155, 1e156, 1e157, 1e158, 1e159, 1e160, 1e161, 1e162, 1e163, 1e164, 1e165, 1e166,
+           1e167, 1e168, 1e169, 1e170, 1e171, 1e172, 1e173, 1e174, 1e175, 1e176, 1e177, 1e178,
+           1e179, 1e180, 1e181, 1e182, 1e183, 1e184, 1e185, 1e186, 1e187, 1e188, 1e189, 1e190,
+           1e191, 1e192, 1e193, 1e194, 1e195, 1e196, 1e197, 1e198, 1e199, 1e200, 1e201, 1e202,
+           1e203, 1e204, 1e205, 1e206, 1e207, 1e208, 1e209, 1e210, 1e211, 1e212, 1e213, 1e214,
+           1e215, 1e216, 1e217, 1e218, 1e219, 1e220, 1e221, 1e222, 1e223, 1e224, 1e225, 1e226,
+           1e227, 1e228, 1e229, 1e230, 1e231, 1e232, 1e233, 1e234, 1e235, 1e236, 1e237, 1e238,
+           1e239, 1e240, 1e241, 1e242, 1e243, 1e244, 1e245, 1e246, 1e247, 1e248, 1e249, 1e250,
+           1e251, 1e252, 1e253, 1e254, 1e255, 1e256, 1e257, 1e258, 1e259, 1e260, 1e261, 1e262,
+           1e263, 1e264, 1e265, 1e266, 1e267, 1e268, 1e269, 1e270, 1e271, 1e272, 1e273, 1e274,
+           1e275, 1e276, 1e277, 1e278, 1e279, 1e280, 1e281, 1e282, 1e283, 1e284, 1e285, 1e286,
+           1e287, 1e288, 1e289, 1e290, 1e291, 1e292, 1e293, 1e294, 1e295, 1e296, 1e297, 1e298,
+           1e299, 1e300, 1e301, 1e302, 1e303, 1e304, 1e305, 1e306, 1e307, 1e308
+#endif
+  }};
+}
+
+constexpr constexpr_array<double, 309> literal_negative_power_of_ten() {
+  return {{1e-0, 1e-1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 1e-8, 1e-9, 1e-10, 1e-11,
+           1e-12, 1e-13, 1e-14, 1e-15, 1e-16, 1e-17, 1e-18, 1e-19, 1e-20, 1e-21, 1e-22, 1e-23,
+           1e-24, 1e-25, 1e-26, 1e-27, 1e-28, 1e-29, 1e-30, 1e-31, 1e-32, 1e-33, 1e-34, 1e-35,
+           1e-36, 1e-37, 1e-38, 1e-39, 1e-40, 1e-41, 1e-42, 1e-43, 1e-44, 1e-45, 1e-46, 1e-47,
+           1e-48, 1e-49, 1e-50, 1e-51, 1e-52, 1e-53, 1e-54, 1e-55, 1e-56, 1e-57, 1e-58, 1e-59,
+           1e-60, 1e-61, 1e-62, 1e-63, 1e-64, 1e-65, 1e-66, 1e-67, 1e-68, 1e-69, 1e-70, 1e-71,
+           1e-72, 1e-73, 1e-74, 1e-75, 1e-76, 1e-77, 1e-78, 1e-79, 1e-80, 1e-81, 1e-82, 1e-83,
+           1e-84, 1e-85, 1e-86, 1e-87, 1e-88, 1e-89, 1e-90, 1e-91, 1e-92, 1e-93, 1e-94, 1e-95,
+           1e-96, 1e-97, 1e-98, 1e-99, 1e-100, 1e-101, 1e-102, 1e-103, 1e-104, 1e-105, 1e-106, 1e-107,
+           1e-108, 1e-109, 1e-110, 1e-111, 1e-112, 1e-113, 1e-114, 1e-115, 1e-116, 1e-117, 1e-118, 1e-119,
+           1e-120, 1e-121, 1e-122, 1e-123, 1e-124, 1e-125, 1e-126, 1e-127, 1e-128, 1e-129, 1e-130, 1e-131,
+           1e-132, 1e-133, 1e-134, 1e-135, 1e-136, 1e-137, 1e-138, 1e-139, 1e-140, 1e-141, 1e-142, 1e-143,
+           1e-144, 1e-145, 1e-146, 1e-147, 1e-148, 1e-149, 1e-150, 1e-151, 1e-152, 1e-153, 1e-154, 1e-155,
+           1e-156, 1e-157, 1e-158, 1e-159, 1e-160, 1e-161, 1e-162, 1e-163, 1e-164, 1e-165, 1e-166, 1e-167,
+           1e-168, 1e-169, 1e-170, 1e-171, 1e-172, 1e-173, 1e-174, 1e-175, 1e-176, 1e-177, 1e-178, 1e-179,
+           1e-180, 1e-181, 1e-182, 1e-183, 1e-184, 1e-185, 1e-186, 1e-187, 1e-188, 1e-189, 1e-190, 1e-191,
+           1e-192, 1e-193, 1e-194, 1e-195, 1e-196, 1e-197, 1e-198, 1e-199, 1e-200, 1e-201, 1e-202, 1e-203,
+           1e-204, 1e-205, 1e-206, 1e-207, 1e-208, 1e-209, 1e-210, 1e-211, 1e-212, 1e-213, 1e-214, 1e-215,
+           1e-216, 1e-217, 1e-218, 1e-219, 1e-220, 1e-221, 1e-222, 1e-223, 1e-224, 1e-225, 1e-226, 1e-227,
+           1e-228, 1e-229, 1e-230, 1e-231, 1e-232, 1e-233, 1e-234, 1e-235, 1e-236, 1e-237, 1e-238, 1e-239,
+           1e-240, 1e-241, 1e-242, 1e-243, 1e-244, 1e-245, 1e-246, 1e-247, 1e-248, 1e-249, 1e-250, 1e-251,
+           1e-252, 1e-253, 1e-254, 1e-255, 1e-256, 1e-257, 1e-258, 1e-259, 1e-260, 1e-261, 1e-262, 1e-263,
+           1e-264, 1e-265, 1e-266, 1e-267, 1e-268, 1e-269, 1e-270, 1e-271, 1e-272, 1e-273, 1e-274, 1e-275,
+           1e-276, 1e-277, 1e-278, 1e-279, 1e-280, 1e-281, 1e-282, 1e-283, 1e-284, 1e-285, 1e-286, 1e-287,
+           1e-288, 1e-289, 1e-290, 1e-291, 1e-292, 1e-293, 1e-294, 1e-295, 1e-296, 1e-297, 1e-298, 1e-299,
+           1e-300, 1e-301, 1e-302, 1e-303, 1e-304, 1e-305, 1e-306, 1e-307, 1e-308}};
+}
+
+constexpr constexpr_array<uint64_t, FASTFLOAT_MANTISSA_POWERS> literal_power_of_ten_mantissa_64() {
+  return {{0xeef453d6923bd65a, 0x9558b4661b6565f8, 0xbaaee17fa23ebf76, 0xe95a99df8ace6f53,
+           0x91d8a02bb6c10594, 0xb64ec836a47146f9, 0xe3e27a444d8d98b7, 0x8e6d8c6ab0787f72,
+           0xb208ef855c969f4f, 0xde8b2b66b3bc4723, 0x8b16fb203055ac76, 0xaddcb9e83c6b1793,
+           0xd953e8624b85dd78, 0x87d4713d6f33aa6b, 0xa9c98d8ccb009506, 0xd43bf0effdc0ba48,
+           0x84a57695fe98746d, 0xa5ced43b7e3e9188, 0xcf42894a5dce35ea, 0x818995ce7aa0e1b2,
+           0xa1ebfb4219491a1f, 0xca66fa129f9b60a6, 0xfd00b897478238d0, 0x9e20735e8cb16382,
+           0xc5a890362fddbc62, 0xf712b443bbd52b7b, 0x9a6bb0aa55653b2d, 0xc1069cd4eabe89f8,
+           0xf148440a256e2c76, 0x96cd2a865764dbca, 0xbc807527ed3e12bc, 0xeba09271e88d976b,
+           0x93445b8731587ea3, 0xb8157268fdae9e4c, 0xe61acf033d1a45df, 0x8fd0c16206306bab,
+           0xb3c4f1ba87bc8696, 0xe0b62e2929aba83c, 0x8c71dcd9ba0b4925, 0xaf8e5410288e1b6f,
+           0xdb71e91432b1a24a, 0x892731ac9faf056e, 0xab70fe17c79ac6ca, 0xd64d3d9db981787d,
+           0x85f0468293f0eb4e, 0xa76c582338ed2621, 0xd1476e2c07286faa, 0x82cca4db847945ca,
+           0xa37fce126597973c, 0xcc5fc196fefd7d0c, 0xff77b1fcbebcdc4f, 0x9faacf3df73609b1,
+           0xc795830d75038c1d, 0xf97ae3d0d2446f25, 0x9becce62836ac577, 0xc2e801fb244576d5,
+           0xf3a20279ed56d48a, 0x9845418c345644d6, 0xbe5691ef416bd60c, 0xedec366b11c6cb8f,
+           0x94b3a202eb1c3f39, 0xb9e08a83a5e34f07, 0xe858ad248f5c22c9, 0x91376c36d99995be,
+           0xb58547448ffffb2d, 0xe2e69915b3fff9f9, 0x8dd01fad907ffc3b, 0xb1442798f49ffb4a,
+           0xdd95317f31c7fa1d, 0x8a7d3eef7f1cfc52, 0xad1c8eab5ee43b66, 0xd863b256369d4a40,
+           0x873e4f75e2224e68, 0xa90de3535aaae202, 0xd3515c2831559a83, 0x8412d9991ed58091,
+           0xa5178fff668ae0b6, 0xce5d73ff402d98e3, 0x80fa687f881c7f8e, 0xa139029f6a239f72,
+           0xc987434744ac874e, 0xfbe9141915d7a922, 0x9d71ac8fada6c9b5, 0xc4ce17b399107c22,
+           0xf6019da07f549b2b, 0x99c102844f94e0fb, 0xc0314325637a1939, 0xf03d93eebc589f88,
+           0x96267c7535b763b5, 0xbbb01b9283253ca2, 0xea9c227723ee8bcb, 0x92a1958a7675175f,
+           0xb749faed14125d36, 0xe51c79a85916f484, 0x8f31cc0937ae58d2, 0xb2fe3f0b8599ef07,
+           0xdfbdcece67006ac9, 0x8bd6a141006042bd, 0xaecc49914078536d, 0xda7f5bf590966848,
+           0x888f99797a5e012d, 0xaab37fd7d8f58178, 0xd5605fcdcf32e1d6, 0x855c3be0a17fcd26,
+           0xa6b34ad8c9dfc06f, 0xd0601d8efc57b08b, 0x823c12795db6ce57, 0xa2cb1717b52481ed,
+           0xcb7ddcdda26da268, 0xfe5d54150b090b02, 0x9efa548d26e5a6e1, 0xc6b8e9b0709f109a,
+           0xf867241c8cc6d4c0, 0x9b407691d7fc44f8, 0xc21094364dfb5636, 0xf294b943e17a2bc4,
+           0x979cf3ca6cec5b5a, 0xbd8430bd08277231, 0xece53cec4a314ebd, 0x940f4613ae5ed136,
+           0xb913179899f68584, 0xe757dd7ec07426e5, 0x9096ea6f3848984f, 0xb4bca50b065abe63,
+           0xe1ebce4dc7f16dfb, 0x8d3360f09cf6e4bd, 0xb080392cc4349dec, 0xdca04777f541c567,
+           0x89e42caaf9491b60, 0xac5d37d5b79b6239, 0xd77485cb25823ac7, 0x86a8d39ef77164bc,
+           0xa8530886b54dbdeb, 0xd267caa862a12d66, 0x8380dea93da4bc60, 0xa46116538d0deb78,
+           0xcd795be870516656, 0x806bd9714632dff6, 0xa086cfcd97bf97f3, 0xc8a883c0fdaf7df0,
+           0xfad2a4b13d1b5d6c, 0x9cc3a6eec6311a63, 0xc3f490aa77bd60fc, 0xf4f1b4d515acb93b,
+           0x991711052d8bf3c5, 0xbf5cd54678eef0b6, 0xef340a98172aace4, 0x9580869f0e7aac0e,
+           0xbae0a846d2195712, 0xe998d258869facd7, 0x91ff83775423cc06, 0xb67f6455292cbf08,
+           0xe41f3d6a7377eeca, 0x8e938662882af53e, 0xb23867fb2a35b28d, 0xdec681f9f4c31f31,
+           0x8b3c113c38f9f37e, 0xae0b158b4738705e, 0xd98ddaee19068c76, 0x87f8a8d4cfa417c9,
+           0xa9f6d30a038d1dbc, 0xd47487cc8470652b, 0x84c8d4dfd2c63f3b, 0xa5fb0a17c777cf09,
+           0xcf79cc9db955c2cc, 0x81ac1fe293d599bf, 0xa21727db38cb002f, 0xca9cf1d206fdc03b,
+           0xfd442e4688bd304a, 0x9e4a9cec15763e2e, 0xc5dd44271ad3cdba, 0xf7549530e188c128,
+           0x9a94dd3e8cf578b9, 0xc13a148e3032d6e7, 0xf18899b1bc3f8ca1, 0x96f5600f15a7b7e5,
+           0xbcb2b812db11a5de, 0xebdf661791d60f56, 0x936b9fcebb25c995, 0xb84687c269ef3bfb,
+           0xe65829b3046b0afa, 0x8ff71a0fe2c2e6dc, 0xb3f4e093db73a093, 0xe0f218b8d25088b8,
+           0x8c974f7383725573, 0xafbd2350644eeacf, 0xdbac6c247d62a583, 0x894bc396ce5da772,
+           0xab9eb47c81f5114f, 0xd686619ba27255a2, 0x8613fd0145877585, 0xa798fc4196e952e7,
+           0xd17f3b51fca3a7a0, 0x82ef85133de648c4, 0xa3ab66580d5fdaf5, 0xcc963fee10b7d1b3,
+           0xffbbcfe994e5c61f, 0x9fd561f1fd0f9bd3, 0xc7caba6e7c5382c8, 0xf9bd690a1b68637b,
+           0x9c1661a651213e2d, 0xc31bfa0fe5698db8, 0xf3e2f893dec3f126, 0x986ddb5c6b3a76b7,
+           0xbe89523386091465, 0xee2ba6c0678b597f, 0x94db483840b717ef, 0xba121a4650e4ddeb,
+           0xe896a0d7e51e1566, 0x915e2486ef32cd60, 0xb5b5ada8aaff80b8, 0xe3231912d5bf60e6,
+           0x8df5efabc5979c8f, 0xb1736b96b6fd83b3, 0xddd0467c64bce4a0, 0x8aa22c0dbef60ee4,
+           0xad4ab7112eb3929d, 0xd89d64d57a607744, 0x87625f056c7c4a8b, 0xa93af6c6c79b5d2d,
+           0xd389b47879823479, 0x843610cb4bf160cb, 0xa54394fe1eedb8fe, 0xce947a3da6a9273e,
+           0x811ccc668829b887, 0xa163ff802a3426a8, 0xc9bcff6034c13052, 0xfc2c3f3841f17c67,
+           0x9d9ba7832936edc0, 0xc5029163f384a931, 0xf64335bcf065d37d, 0x99ea0196163fa42e,
+           0xc06481fb9bcf8d39, 0xf07da27a82c37088, 0x964e858c91ba2655, 0xbbe226efb628afea,
+           0xeadab0aba3b2dbe5, 0x92c8ae6b464fc96f, 0xb77ada0617e3bbcb, 0xe55990879ddcaabd,
+           0x8f57fa54c2a9eab6, 0xb32df8e9f3546564, 0xdff9772470297ebd, 0x8bfbea76c619ef36,
+           0xaefae51477a06b03, 0xdab99e59958885c4, 0x88b402f7fd75539b, 0xaae103b5fcd2a881,
+           0xd59944a37c0752a2, 0x857fcae62d8493a5, 0xa6dfbd9fb8e5b88e, 0xd097ad07a71f26b2,
+           0x825ecc24c873782f, 0xa2f67f2dfa90563b, 0xcbb41ef979346bca, 0xfea126b7d78186bc,
+           0x9f24b832e6b0f436, 0xc6ede63fa05d3143, 0xf8a95fcf88747d94, 0x9b69dbe1b548ce7c,
+           0xc24452da229b021b, 0xf2d56790ab41c2a2, 0x97c560ba6b0919a5, 0xbdb6b8e905cb600f,
+           0xed246723473e3813, 0x9436c0760c86e30b, 0xb94470938fa89bce, 0xe7958cb87392c2c2,
+           0x90bd77f3483bb9b9, 0xb4ecd5f01a4aa828, 0xe2280b6c20dd5232, 0x8d590723948a535f,
+           0xb0af48ec79ace837, 0xdcdb1b2798182244, 0x8a08f0f8bf0f156b, 0xac8b2d36eed2dac5,
+           0xd7adf884aa879177, 0x86ccbb52ea94baea, 0xa87fea27a539e9a5, 0xd29fe4b18e88640e,
+           0x83a3eeeef9153e89, 0xa48ceaaab75a8e2b, 0xcdb02555653131b6, 0x808e17555f3ebf11,
+           0xa0b19d2ab70e6ed6, 0xc8de047564d20a8b, 0xfb158592be068d2e, 0x9ced737bb6c4183d,
+           0xc428d05aa4751e4c, 0xf53304714d9265df, 0x993fe2c6d07b7fab, 0xbf8fdb78849a5f96,
+           0xef73d256a5c0f77c, 0x95a8637627989aad, 0xbb127c53b17ec159, 0xe9d71b689dde71af,
+           0x9226712162ab070d, 0xb6b00d69bb55c8d1, 0xe45c10c42a2b3b05, 0x8eb98a7a9a5b04e3,
+           0xb267ed1940f1c61c, 0xdf01e85f912e37a3, 0x8b61313bbabce2c6, 0xae397d8aa96c1b77,
+           0xd9c7dced53c72255, 0x881cea14545c7575, 0xaa242499697392d2, 0xd4ad2dbfc3d07787,
+           0x84ec3c97da624ab4, 0xa6274bbdd0fadd61, 0xcfb11ead453994ba, 0x81ceb32c4b43fcf4,
+           0xa2425ff75e14fc31, 0xcad2f7f5359a3b3e, 0xfd87b5f28300ca0d, 0x9e74d1b791e07e48,
+           0xc612062576589dda, 0xf79687aed3eec551, 0x9abe14cd44753b52, 0xc16d9a0095928a27,
+           0xf1c90080baf72cb1, 0x971da05074da7bee, 0xbce5086492111aea, 0xec1e4a7db69561a5,
+           0x9392ee8e921d5d07, 0xb877aa3236a4b449, 0xe69594bec44de15b, 0x901d7cf73ab0acd9,
+           0xb424dc35095cd80f, 0xe12e13424bb40e13, 0x8cbccc096f5088cb, 0xafebff0bcb24aafe,
+           0xdbe6fecebdedd5be, 0x89705f4136b4a597, 0xabcc77118461cefc, 0xd6bf94d5e57a42bc,
+           0x8637bd05af6c69b5, 0xa7c5ac471b478423, 0xd1b71758e219652b, 0x83126e978d4fdf3b,
+           0xa3d70a3d70a3d70a, 0xcccccccccccccccc, 0x8000000000000000, 0xa000000000000000,
+           0xc800000000000000, 0xfa00000000000000, 0x9c40000000000000, 0xc350000000000000,
+           0xf424000000000000, 0x9896800000000000, 0xbebc200000000000, 0xee6b280000000000,
+           0x9502f90000000000, 0xba43b74000000000, 0xe8d4a51000000000, 0x9184e72a00000000,
+           0xb5e620f480000000, 0xe35fa931a0000000, 0x8e1bc9bf04000000, 0xb1a2bc2ec5000000,
+           0xde0b6b3a76400000, 0x8ac7230489e80000, 0xad78ebc5ac620000, 0xd8d726b7177a8000,
+           0x878678326eac9000, 0xa968163f0a57b400, 0xd3c21bcecceda100, 0x84595161401484a0,
+           0xa56fa5b99019a5c8, 0xcecb8f27f4200f3a, 0x813f3978f8940984, 0xa18f07d736b90be5,
+           0xc9f2c9cd04674ede, 0xfc6f7c4045812296, 0x9dc5ada82b70b59d, 0xc5371912364ce305,
+           0xf684df56c3e01bc6, 0x9a130b963a6c115c, 0xc097ce7bc90715b3, 0xf0bdc21abb48db20,
+           0x96769950b50d88f4, 0xbc143fa4e250eb31, 0xeb194f8e1ae525fd, 0x92efd1b8d0cf37be,
+           0xb7abc627050305ad, 0xe596b7b0c643c719, 0x8f7e32ce7bea5c6f, 0xb35dbf821ae4f38b,
+           0xe0352f62a19e306e, 0x8c213d9da502de45, 0xaf298d050e4395d6, 0xdaf3f04651d47b4c,
+           0x88d8762bf324cd0f, 0xab0e93b6efee0053, 0xd5d238a4abe98068, 0x85a36366eb71f041,
+           0xa70c3c40a64e6c51, 0xd0cf4b50cfe20765, 0x82818f1281ed449f, 0xa321f2d7226895c7,
+           0xcbea6f8ceb02bb39, 0xfee50b7025c36a08, 0x9f4f2726179a2245, 0xc722f0ef9d80aad6,
+           0xf8ebad2b84e0d58b, 0x9b934c3b330c8577, 0xc2781f49ffcfa6d5, 0xf316271c7fc3908a,
+           0x97edd871cfda3a56, 0xbde94e8e43d0c8ec, 0xed63a231d4c4fb27, 0x945e455f24fb1cf8,
+           0xb975d6b6ee39e436, 0xe7d34c64a9c85d44, 0x90e40fbeea1d3a4a, 0xb51d13aea4a488dd,
+           0xe264589a4dcdab14, 0x8d7eb76070a08aec, 0xb0de65388cc8ada8, 0xdd15fe86affad912,
+           0x8a2dbf142dfcc7ab, 0xacb92ed9397bf996, 0xd7e77a8f87daf7fb, 0x86f0ac99b4e8dafd,
+           0xa8acd7c0222311bc, 0xd2d80db02aabd62b, 0x83c7088e1aab65db, 0xa4b8cab1a1563f52,
+           0xcde6fd5e09abcf26, 0x80b05e5ac60b6178, 0xa0dc75f1778e39d6, 0xc913936dd571c84c,
+           0xfb5878494ace3a5f, 0x9d174b2dcec0e47b, 0xc45d1df942711d9a, 0xf5746577930d6500,
+           0x9968bf6abbe85f20, 0xbfc2ef456ae276e8, 0xefb3ab16c59b14a2, 0x95d04aee3b80ece5,
+           0xbb445da9ca61281f, 0xea1575143cf97226, 0x924d692ca61be758, 0xb6e0c377cfa2e12e,
+           0xe498f455c38b997a, 0x8edf98b59a373fec, 0xb2977ee300c50fe7, 0xdf3d5e9bc0f653e1,
+           0x8b865b215899f46c, 0xae67f1e9aec07187, 0xda01ee641a708de9, 0x884134fe908658b2,
+           0xaa51823e34a7eede, 0xd4e5e2cdc1d1ea96, 0x850fadc09923329e, 0xa6539930bf6bff45,
+           0xcfe87f7cef46ff16, 0x81f14fae158c5f6e, 0xa26da3999aef7749, 0xcb090c8001ab551c,
+           0xfdcb4fa002162a63, 0x9e9f11c4014dda7e, 0xc646d63501a1511d, 0xf7d88bc24209a565,
+           0x9ae757596946075f, 0xc1a12d2fc3978937, 0xf209787bb47d6b84, 0x9745eb4d50ce6332,
+           0xbd176620a501fbff, 0xec5d3fa8ce427aff, 0x93ba47c980e98cdf, 0xb8a8d9bbe123f017,
+           0xe6d3102ad96cec1d, 0x9043ea1ac7e41392, 0xb454e4a179dd1877, 0xe16a1dc9d8545e94,
+           0x8ce2529e2734bb1d, 0xb01ae745b101e9e4, 0xdc21a1171d42645d, 0x899504ae72497eba,
+           0xabfa45da0edbde69, 0xd6f8d7509292d603, 0x865b86925b9bc5c2, 0xa7f26836f282b732,
+           0xd1ef0244af2364ff, 0x8335616aed761f1f, 0xa402b9c5a8d3a6e7, 0xcd036837130890a1,
+           0x802221226be55a64, 0xa02aa96b06deb0fd, 0xc83553c5c8965d3d, 0xfa42a8b73abbf48c,
+           0x9c69a97284b578d7, 0xc38413cf25e2d70d, 0xf46518c2ef5b8cd1, 0x98bf2f79d5993802,
+           0xbeeefb584aff8603, 0xeeaaba2e5dbf6784, 0x952ab45cfa97a0b2, 0xba756174393d88df,
+           0xe912b9d1478ceb17, 0x91abb422ccb812ee, 0xb616a12b7fe617aa, 0xe39c49765fdf9d94,
+           0x8e41ade9fbebc27d, 0xb1d219647ae6b31c, 0xde469fbd99a05fe3, 0x8aec23d680043bee,
+           0xada72ccc20054ae9, 0xd910f7ff28069da4, 0x87aa9aff79042286, 0xa99541bf57452b28,
+           0xd3fa922f2d1675f2, 0x847c9b5d7c2e09b7, 0xa59bc234db398c25, 0xcf02b2c21207ef2e,
+           0x8161afb94b44f57d, 0xa1ba1ba79e1632dc, 0xca28a291859bbf93, 0xfcb2cb35e702af78,
+           0x9defbf01b061adab, 0xc56baec21c7a1916, 0xf6c69a72a3989f5b, 0x9a3c2087a63f6399,
+           0xc0cb28a98fcf3c7f, 0xf0fdf2d3f3c30b9f, 0x969eb7c47859e743, 0xbc4665b596706114,
+           0xeb57ff22fc0c7959, 0x9316ff75dd87cbd8, 0xb7dcbf5354e9bece, 0xe5d3ef282a242e81,
+           0x8fa475791a569d10, 0xb38d92d760ec4455, 0xe070f78d3927556a, 0x8c469ab843b89562,
+           0xaf58416654a6babb, 0xdb2e51bfe9d0696a, 0x88fcf317f22241e2, 0xab3c2fddeeaad25a,
+           0xd60b3bd56a5586f1, 0x85c7056562757456, 0xa738c6bebb12d16c, 0xd106f86e69d785c7,
+           0x82a45b450226b39c, 0xa34d721642b06084, 0xcc20ce9bd35c78a5, 0xff290242c83396ce,
+           0x9f79a169bd203e41, 0xc75809c42c684dd1, 0xf92e0c3537826145, 0x9bbcc7a142b17ccb,
+           0xc2abf989935ddbfe, 0xf356f7ebf83552fe, 0x98165af37b2153de, 0xbe1bf1b059e9a8d6,
+           0xeda2ee1c7064130c, 0x9485d4d1c63e8be7, 0xb9a74a0637ce2ee1, 0xe8111c87c5c1ba99,
+           0x910ab1d4db9914a0, 0xb54d5e4a127f59c8, 0xe2a0b5dc971f303a, 0x8da471a9de737e24,
+           0xb10d8e1456105dad, 0xdd50f1996b947518, 0x8a5296ffe33cc92f, 0xace73cbfdc0bfb7b,
+           0xd8210befd30efa5a, 0x8714a775e3e95c78, 0xa8d9d1535ce3b396, 0xd31045a8341ca07c,
+           0x83ea2b892091e44d, 0xa4e4b66b68b65d60, 0xce1de40642e3f4b9, 0x80d2ae83e9ce78f3,
+           0xa1075a24e4421730, 0xc94930ae1d529cfc, 0xfb9b7cd9a4a7443c, 0x9d412e0806e88aa5,
+           0xc491798a08a2ad4e, 0xf5b5d7ec8acb58a2, 0x9991a6f3d6bf1765, 0xbff610b0cc6edd3f,
+           0xeff394dcff8a948e, 0x95f83d0a1fb69cd9, 0xbb764c4ca7a4440f, 0xea53df5fd18d5513,
+           0x92746b9be2f8552c, 0xb7118682dbb66a77, 0xe4d5e82392a40515, 0x8f05b1163ba6832d,
+           0xb2c71d5bca9023f8, 0xdf78e4b2bd342cf6, 0x8bab8eefb6409c1a, 0xae9672aba3d0c320,
+           0xda3c0f568cc4f3e8, 0x8865899617fb1871, 0xaa7eebfb9df9de8d, 0xd51ea6fa85785631,
+           0x8533285c936b35de, 0xa67ff273b8460356, 0xd01fef10a657842c, 0x8213f56a67f6b29b,
+           0xa298f2c501f45f42, 0xcb3f2f7642717713, 0xfe0efb53d30dd4d7, 0x9ec95d1463e8a506,
+           0xc67bb4597ce2ce48, 0xf81aa16fdc1b81da, 0x9b10a4e5e9913128, 0xc1d4ce1f63f57d72,
+           0xf24a01a73cf2dccf, 0x976e41088617ca01, 0xbd49d14aa79dbc82, 0xec9c459d51852ba2,
+           0x93e1ab8252f33b45, 0xb8da1662e7b00a17, 0xe7109bfba19c0c9d, 0x906a617d450187e2,
+           0xb484f9dc9641e9da, 0xe1a63853bbd26451, 0x8d07e33455637eb2, 0xb049dc016abc5e5f,
+           0xdc5c5301c56b75f7, 0x89b9b3e11b6329ba, 0xac2820d9623bf429, 0xd732290fbacaf133,
+           0x867f59a9d4bed6c0, 0xa81f301449ee8c70, 0xd226fc195c6a2f8c, 0x83585d8fd9c25db7,
+           0xa42e74f3d032f525, 0xcd3a1230c43fb26f, 0x80444b5e7aa7cf85, 0xa0555e361951c366,
+           0xc86ab5c39fa63440, 0xfa856334878fc150, 0x9c935e00d4b9d8d2, 0xc3b8358109e84f07,
+           0xf4a642e14c6262c8, 0x98e7e9cccfbd7dbd, 0xbf21e44003acdd2c, 0xeeea5d5004981478,
+           0x95527a5202df0ccb, 0xbaa718e68396cffd, 0xe950df20247c83fd, 0x91d28b7416cdd27e,
+           0xb6472e511c81471d, 0xe3d8f9e563a198e5, 0x8e679c2f5e44ff8f}};
+}
+
+constexpr constexpr_array<uint64_t, FASTFLOAT_MANTISSA_POWERS> literal_mantissa_128() {
+  return {{0x113faa2906a13b3f, 0x4ac7ca59a424c507, 0x5d79bcf00d2df649, 0xf4d82c2c107973dc,
+           0x79071b9b8a4be869, 0x9748e2826cdee284, 0xfd1b1b2308169b25, 0xfe30f0f5e50e20f7,
+           0xbdbd2d335e51a935, 0xad2c788035e61382, 0x4c3bcb5021afcc31, 0xdf4abe242a1bbf3d,
+           0xd71d6dad34a2af0d, 0x8672648c40e5ad68, 0x680efdaf511f18c2, 0x0212bd1b2566def2,
+           0x014bb630f7604b57, 0x419ea3bd35385e2d, 0x52064cac828675b9, 0x7343efebd1940993,
+           0x1014ebe6c5f90bf8, 0xd41a26e077774ef6, 0x8920b098955522b4, 0x55b46e5f5d5535b0,
+           0xeb2189f734aa831d, 0xa5e9ec7501d523e4, 0x47b233c92125366e, 0x999ec0bb696e840a,
+           0xc00670ea43ca250d, 0x380406926a5e5728, 0xc605083704f5ecf2, 0xf7864a44c633682e,
+           0x7ab3ee6afbe0211d, 0x5960ea05bad82964, 0x6fb92487298e33bd, 0xa5d3b6d479f8e056,
+           0x8f48a4899877186c, 0x331acdabfe94de87, 0x9ff0c08b7f1d0b14, 0x07ecf0ae5ee44dd9,
+           0xc9e82cd9f69d6150, 0xbe311c083a225cd2, 0x6dbd630a48aaf406, 0x092cbbccdad5b108,
+           0x25bbf56008c58ea5, 0xaf2af2b80af6f24e, 0x1af5af660db4aee1, 0x50d98d9fc890ed4d,
+           0xe50ff107bab528a0, 0x1e53ed49a96272c8, 0x25e8e89c13bb0f7a, 0x77b191618c54e9ac,
+           0xd59df5b9ef6a2417, 0x4b0573286b44ad1d, 0x4ee367f9430aec32, 0x229c41f793cda73f,
+           0x6b43527578c1110f, 0x830a13896b78aaa9, 0x23cc986bc656d553, 0x2cbfbe86b7ec8aa8,
+           0x7bf7d71432f3d6a9, 0xdaf5ccd93fb0cc53, 0xd1b3400f8f9cff68, 0x23100809b9c21fa1,
+           0xabd40a0c2832a78a, 0x16c90c8f323f516c, 0xae3da7d97f6792e3, 0x99cd11cfdf41779c,
+           0x40405643d711d583, 0x482835ea666b2572, 0xda3243650005eecf, 0x90bed43e40076a82,
+           0x5a7744a6e804a291, 0x711515d0a205cb36, 0x0d5a5b44ca873e03, 0xe858790afe9486c2,
+           0x626e974dbe39a872, 0xfb0a3d212dc8128f, 0x7ce66634bc9d0b99, 0x1c1fffc1ebc44e80,
+           0xa327ffb266b56220, 0x4bf1ff9f0062baa8, 0x6f773fc3603db4a9, 0xcb550fb4384d21d3,
+           0x7e2a53a146606a48, 0x2eda7444cbfc426d, 0xfa911155fefb5308, 0x793555ab7eba27ca,
+           0x4bc1558b2f3458de, 0x9eb1aaedfb016f16, 0x465e15a979c1cadc, 0x0bfacd89ec191ec9,
+           0xcef980ec671f667b, 0x82b7e12780e7401a, 0xd1b2ecb8b0908810, 0x861fa7e6dcb4aa15,
+           0x67a791e093e1d49a, 0xe0c8bb2c5c6d24e0, 0x58fae9f773886e18, 0xaf39a475506a899e,
+           0x6d8406c952429603, 0xc8e5087ba6d33b83, 0xfb1e4a9a90880a64, 0x5cf2eea09a55067f,
+           0xf42faa48c0ea481e, 0xf13b94daf124da26, 0x76c53d08d6b70858, 0x54768c4b0c64ca6e,
+           0xa9942f5dcf7dfd09, 0xd3f93b35435d7c4c, 0xc47bc5014a1a6daf, 0x359ab6419ca1091b,
+           0xc30163d203c94b62, 0x79e0de63425dcf1d, 0x985915fc12f542e4, 0x3e6f5b7b17b2939d,
+           0xa705992ceecf9c42, 0x50c6ff782a838353, 0xa4f8bf5635246428, 0x871b7795e136be99,
+           0x28e2557b59846e3f, 0x331aeada2fe589cf, 0x3ff0d2c85def7621, 0x0fed077a756b53a9,
+           0xd3e8495912c62894, 0x64712dd7abbbd95c, 0xbd8d794d96aacfb3, 0xecf0d7a0fc5583a0,
+           0xf41686c49db57244, 0x311c2875c522ced5, 0x7d633293366b828b, 0xae5dff9c02033197,
+           0xd9f57f830283fdfc, 0xd072df63c324fd7b, 0x4247cb9e59f71e6d, 0x52d9be85f074e608,
+           0x67902e276c921f8b, 0x00ba1cd8a3db53b6, 0x80e8a40eccd228a4, 0x6122cd128006b2cd,
+           0x796b805720085f81, 0xcbe3303674053bb0, 0xbedbfc4411068a9c, 0xee92fb5515482d44,
+           0x751bdd152d4d1c4a, 0xd262d45a78a0635d, 0x86fb897116c87c34, 0xd45d35e6ae3d4da0,
+           0x8974836059cca109, 0x2bd1a438703fc94b, 0x7b6306a34627ddcf, 0x1a3bc84c17b1d542,
+           0x20caba5f1d9e4a93, 0x547eb47b7282ee9c, 0xe99e619a4f23aa43, 0x6405fa00e2ec94d4,
+           0xde83bc408dd3dd04, 0x9624ab50b148d445, 0x3badd624dd9b0957, 0xe54ca5d70a80e5d6,
+           0x5e9fcf4ccd211f4c, 0x7647c3200069671f, 0x29ecd9f40041e073, 0xf468107100525890,
+           0x7182148d4066eeb4, 0xc6f14cd848405530, 0xb8ada00e5a506a7c, 0xa6d90811f0e4851c,
+           0x908f4a166d1da663, 0x9a598e4e043287fe, 0x40eff1e1853f29fd, 0xd12bee59e68ef47c,
+           0x82bb74f8301958ce, 0xe36a52363c1faf01, 0xdc44e6c3cb279ac1, 0x29ab103a5ef8c0b9,
+           0x7415d448f6b6f0e7, 0x111b495b3464ad21, 0xcab10dd900beec34, 0x3d5d514f40eea742,
+           0x0cb4a5a3112a5112, 0x47f0e785eaba72ab, 0x59ed216765690f56, 0x306869c13ec3532c,
+           0x1e414218c73a13fb, 0xe5d1929ef90898fa, 0xdf45f746b74abf39, 0x6b8bba8c328eb783,
+           0x066ea92f3f326564, 0xc80a537b0efefebd, 0xbd06742ce95f5f36, 0x2c48113823b73704,
+           0xf75a15862ca504c5, 0x9a984d73dbe722fb, 0xc13e60d0d2e0ebba, 0x318df905079926a8,
+           0xfdf17746497f7052, 0xfeb6ea8bedefa633, 0xfe64a52ee96b8fc0, 0x3dfdce7aa3c673b0,
+           0x06bea10ca65c084e, 0x486e494fcff30a62, 0x5a89dba3c3efccfa, 0xf89629465a75e01c,
+           0xf6bbb397f1135823, 0x746aa07ded582e2c, 0xa8c2a44eb4571cdc, 0x92f34d62616ce413,
+           0x77b020baf9c81d17, 0x0ace1474dc1d122e, 0x0d819992132456ba, 0x10e1fff697ed6c69,
+           0xca8d3ffa1ef463c1, 0xbd308ff8a6b17cb2, 0xac7cb3f6d05ddbde, 0x6bcdf07a423aa96b,
+           0x86c16c98d2c953c6, 0xe871c7bf077ba8b7, 0x11471cd764ad4972, 0xd598e40d3dd89bcf,
+           0x4aff1d108d4ec2c3, 0xcedf722a585139ba, 0xc2974eb4ee658828, 0x733d226229feea32,
+           0x0806357d5a3f525f, 0xca07c2dcb0cf26f7, 0xfc89b393dd02f0b5, 0xbbac2078d443ace2,
+           0xd54b944b84aa4c0d, 0x0a9e795e65d4df11, 0x4d4617b5ff4a16d5, 0x504bced1bf8e4e45,
+           0xe45ec2862f71e1d6, 0x5d767327bb4e5a4c, 0x3a6a07f8d510f86f, 0x890489f70a55368b,
+           0x2b45ac74ccea842e, 0x3b0b8bc90012929d, 0x09ce6ebb40173744, 0xcc420a6a101d0515,
+           0x9fa946824a12232d, 0x47939822dc96abf9, 0x59787e2b93bc56f7, 0x57eb4edb3c55b65a,
+           0xede622920b6b23f1, 0xe95fab368e45eced, 0x11dbcb0218ebb414, 0xd652bdc29f26a119,
+           0x4be76d3346f0495f, 0x6f70a4400c562ddb, 0xcb4ccd500f6bb952, 0x7e2000a41346a7a7,
+           0x8ed400668c0c28c8, 0x728900802f0f32fa, 0x4f2b40a03ad2ffb9, 0xe2f610c84987bfa8,
+           0x0dd9ca7d2df4d7c9, 0x91503d1c79720dbb, 0x75a44c6397ce912a, 0xc986afbe3ee11aba,
+           0xfbe85badce996168, 0xfae27299423fb9c3, 0xdccd879fc967d41a, 0x5400e987bbc1c920,
+           0x290123e9aab23b68, 0xf9a0b6720aaf6521, 0xf808e40e8d5b3e69, 0xb60b1d1230b20e04,
+           0xb1c6f22b5e6f48c2, 0x1e38aeb6360b1af3, 0x25c6da63c38de1b0, 0x579c487e5a38ad0e,
+           0x2d835a9df0c6d851, 0xf8e431456cf88e65, 0x1b8e9ecb641b58ff, 0xe272467e3d222f3f,
+           0x5b0ed81dcc6abb0f, 0x98e947129fc2b4e9, 0x3f2398d747b36224, 0x8eec7f0d19a03aad,
+           0x1953cf68300424ac, 0x5fa8c3423c052dd7, 0x3792f412cb06794d, 0xe2bbd88bbee40bd0,
+           0x5b6aceaeae9d0ec4, 0xf245825a5a445275, 0xeed6e2f0f0d56712, 0x55464dd69685606b,
+           0xaa97e14c3c26b886, 0xd53dd99f4b3066a8, 0xe546a8038efe4029, 0xde98520472bdd033,
+           0x963e66858f6d4440, 0xdde7001379a44aa8, 0x5560c018580d5d52, 0xaab8f01e6e10b4a6,
+           0xcab3961304ca70e8, 0x3d607b97c5fd0d22, 0x8cb89a7db77c506a, 0x77f3608e92adb242,
+           0x55f038b237591ed3, 0x6b6c46dec52f6688, 0x2323ac4b3b3da015, 0xabec975e0a0d081a,
+           0x96e7bd358c904a21, 0x7e50d64177da2e54, 0xdde50bd1d5d0b9e9, 0x955e4ec64b44e864,
+           0xbd5af13bef0b113e, 0xecb1ad8aeacdd58e, 0x67de18eda5814af2, 0x80eacf948770ced7,
+           0xa1258379a94d028d, 0x096ee45813a04330, 0x8bca9d6e188853fc, 0x775ea264cf55347e,
+           0x95364afe032a819e, 0x3a83ddbd83f52205, 0xc4926a9672793543, 0x75b7053c0f178294,
+           0x5324c68b12dd6339, 0xd3f6fc16ebca5e04, 0x88f4bb1ca6bcf585, 0x2b31e9e3d06c32e6,
+           0x3aff322e62439fd0, 0x09befeb9fad487c3, 0x4c2ebe687989a9b4, 0x0f9d37014bf60a11,
+           0x538484c19ef38c95, 0x2865a5f206b06fba, 0xf93f87b7442e45d4, 0xf78f69a51539d749,
+           0xb573440e5a884d1c, 0x31680a88f8953031, 0xfdc20d2b36ba7c3e, 0x3d32907604691b4d,
+           0xa63f9a49c2c1b110, 0x0fcf80dc33721d54, 0xd3c36113404ea4a9, 0x645a1cac083126ea,
+           0x3d70a3d70a3d70a4, 0xcccccccccccccccd, 0x0000000000000000, 0x0000000000000000,
+           0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+           0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+           0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+           0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+           0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+           0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+           0x0000000000000000, 0x0000000000000000, 0x4000000000000000, 0x5000000000000000,
+           0xa400000000000000, 0x4d00000000000000, 0xf020000000000000, 0x6c28000000000000,
+           0xc732000000000000, 0x3c7f400000000000, 0x4b9f100000000000, 0x1e86d40000000000,
+           0x1314448000000000, 0x17d955a000000000, 0x5dcfab0800000000, 0x5aa1cae500000000,
+           0xf14a3d9e40000000, 0x6d9ccd05d0000000, 0xe4820023a2000000, 0xdda2802c8a800000,
+           0xd50b2037ad200000, 0x4526f422cc340000, 0x9670b12b7f410000, 0x3c0cdd765f114000,
+           0xa5880a69fb6ac800, 0x8eea0d047a457a00, 0x72a4904598d6d880, 0x47a6da2b7f864750,
+           0x999090b65f67d924, 0xfff4b4e3f741cf6d, 0xbff8f10e7a8921a4, 0xaff72d52192b6a0d,
+           0x9bf4f8a69f764490, 0x02f236d04753d5b4, 0x01d762422c946590, 0x424d3ad2b7b97ef5,
+           0xd2e0898765a7deb2, 0x63cc55f49f88eb2f, 0x3cbf6b71c76b25fb, 0x8bef464e3945ef7a,
+           0x97758bf0e3cbb5ac, 0x3d52eeed1cbea317, 0x4ca7aaa863ee4bdd, 0x8fe8caa93e74ef6a,
+           0xb3e2fd538e122b44, 0x60dbbca87196b616, 0xbc8955e946fe31cd, 0x6babab6398bdbe41,
+           0xc696963c7eed2dd1, 0xfc1e1de5cf543ca2, 0x3b25a55f43294bcb, 0x49ef0eb713f39ebe,
+           0x6e3569326c784337, 0x49c2c37f07965404, 0xdc33745ec97be906, 0x69a028bb3ded71a3,
+           0xc40832ea0d68ce0c, 0xf50a3fa490c30190, 0x792667c6da79e0fa, 0x577001b891185938,
+           0xed4c0226b55e6f86, 0x544f8158315b05b4, 0x696361ae3db1c721, 0x03bc3a19cd1e38e9,
+           0x04ab48a04065c723, 0x62eb0d64283f9c76, 0x3ba5d0bd324f8394, 0xca8f44ec7ee36479,
+           0x7e998b13cf4e1ecb, 0x9e3fedd8c321a67e, 0xc5cfe94ef3ea101e, 0xbba1f1d158724a12,
+           0x2a8a6e45ae8edc97, 0xf52d09d71a3293bd, 0x593c2626705f9c56, 0x6f8b2fb00c77836c,
+           0x0b6dfb9c0f956447, 0x4724bd4189bd5eac, 0x58edec91ec2cb657, 0x2f2967b66737e3ed,
+           0xbd79e0d20082ee74, 0xecd8590680a3aa11, 0xe80e6f4820cc9495, 0x3109058d147fdcdd,
+           0xbd4b46f0599fd415, 0x6c9e18ac7007c91a, 0x03e2cf6bc604ddb0, 0x84db8346b786151c,
+           0xe612641865679a63, 0x4fcb7e8f3f60c07e, 0xe3be5e330f38f09d, 0x5cadf5bfd3072cc5,
+           0x73d9732fc7c8f7f6, 0x2867e7fddcdd9afa, 0xb281e1fd541501b8, 0x1f225a7ca91a4226,
+           0x3375788de9b06958, 0x0052d6b1641c83ae, 0xc0678c5dbd23a49a, 0xf840b7ba963646e0,
+           0xb650e5a93bc3d898, 0xa3e51f138ab4cebe, 0xc66f336c36b10137, 0xb80b0047445d4184,
+           0xa60dc059157491e5, 0x87c89837ad68db2f, 0x29babe4598c311fb, 0xf4296dd6fef3d67a,
+           0x1899e4a65f58660c, 0x5ec05dcff72e7f8f, 0x76707543f4fa1f73, 0x6a06494a791c53a8,
+           0x0487db9d17636892, 0x45a9d2845d3c42b6, 0x0b8a2392ba45a9b2, 0x8e6cac7768d7141e,
+           0x3207d795430cd926, 0x7f44e6bd49e807b8, 0x5f16206c9c6209a6, 0x36dba887c37a8c0f,
+           0xc2494954da2c9789, 0xf2db9baa10b7bd6c, 0x6f92829494e5acc7, 0xcb772339ba1f17f9,
+           0xff2a760414536efb, 0xfef5138519684aba, 0x7eb258665fc25d69, 0xef2f773ffbd97a61,
+           0xaafb550ffacfd8fa, 0x95ba2a53f983cf38, 0xdd945a747bf26183, 0x94f971119aeef9e4,
+           0x7a37cd5601aab85d, 0xac62e055c10ab33a, 0x577b986b314d6009, 0xed5a7e85fda0b80b,
+           0x14588f13be847307, 0x596eb2d8ae258fc8, 0x6fca5f8ed9aef3bb, 0x25de7bb9480d5854,
+           0xaf561aa79a10ae6a, 0x1b2ba1518094da04, 0x90fb44d2f05d0842, 0x353a1607ac744a53,
+           0x42889b8997915ce8, 0x69956135febada11, 0x43fab9837e699095, 0x94f967e45e03f4bb,
+           0x1d1be0eebac278f5, 0x6462d92a69731732, 0x7d7b8f7503cfdcfe, 0x5cda735244c3d43e,
+           0x3a0888136afa64a7, 0x088aaa1845b8fdd0, 0x8aad549e57273d45, 0x36ac54e2f678864b,
+           0x84576a1bb416a7dd, 0x656d44a2a11c51d5, 0x9f644ae5a4b1b325, 0x873d5d9f0dde1fee,
+           0xa90cb506d155a7ea, 0x09a7f12442d588f2, 0x0c11ed6d538aeb2f, 0x8f1668c8a86da5fa,
+           0xf96e017d694487bc, 0x37c981dcc395a9ac, 0x85bbe253f47b1417, 0x93956d7478ccec8e,
+           0x387ac8d1970027b2, 0x06997b05fcc0319e, 0x441fece3bdf81f03, 0xd527e81cad7626c3,
+           0x8a71e223d8d3b074, 0xf6872d5667844e49, 0xb428f8ac016561db, 0xe13336d701beba52,
+           0xecc0024661173473, 0x27f002d7f95d0190, 0x31ec038df7b441f4, 0x7e67047175a15271,
+           0x0f0062c6e984d386, 0x52c07b78a3e60868, 0xa7709a56ccdf8a82, 0x88a66076400bb691,
+           0x6acff893d00ea435, 0x0583f6b8c4124d43, 0xc3727a337a8b704a, 0x744f18c0592e4c5c,
+           0x1162def06f79df73, 0x8addcb5645ac2ba8, 0x6d953e2bd7173692, 0xc8fa8db6ccdd0437,
+           0x1d9c9892400a22a2, 0x2503beb6d00cab4b, 0x2e44ae64840fd61d, 0x5ceaecfed289e5d2,
+           0x7425a83e872c5f47, 0xd12f124e28f77719, 0x82bd6b70d99aaa6f, 0x636cc64d1001550b,
+           0x3c47f7e05401aa4e, 0x65acfaec34810a71, 0x7f1839a741a14d0d, 0x1ede48111209a050,
+           0x934aed0aab460432, 0xf81da84d5617853f, 0x36251260ab9d668e, 0xc1d72b7c6b426019,
+           0xb24cf65b8612f81f, 0xdee033f26797b627, 0x169840ef017da3b1, 0x8e1f289560ee864e,
+           0xf1a6f2bab92a27e2, 0xae10af696774b1db, 0xacca6da1e0a8ef29, 0x17fd090a58d32af3,
+           0xddfc4b4cef07f5b0, 0x4abdaf101564f98e, 0x9d6d1ad41abe37f1, 0x84c86189216dc5ed,
+           0x32fd3cf5b4e49bb4, 0x3fbc8c33221dc2a1, 0x0fabaf3feaa5334a, 0x29cb4d87f2a7400e,
+           0x743e20e9ef511012, 0x914da9246b255416, 0x1ad089b6c2f7548e, 0xa184ac2473b529b1,
+           0xc9e5d72d90a2741e, 0x7e2fa67c7a658892, 0xddbb901b98feeab7, 0x552a74227f3ea565,
+           0xd53a88958f87275f, 0x8a892abaf368f137, 0x2d2b7569b0432d85, 0x9c3b29620e29fc73,
+           0x8349f3ba91b47b8f, 0x241c70a936219a73, 0xed238cd383aa0110, 0xf4363804324a40aa,
+           0xb143c6053edcd0d5, 0xdd94b7868e94050a, 0xca7cf2b4191c8326, 0xfd1c2f611f63a3f0,
+           0xbc633b39673c8cec, 0xd5be0503e085d813, 0x4b2d8644d8a74e18, 0xddf8e7d60ed1219e,
+           0xcabb90e5c942b503, 0x3d6a751f3b936243, 0x0cc512670a783ad4, 0x27fb2b80668b24c5,
+           0xb1f9f660802dedf6, 0x5e7873f8a0396973, 0xdb0b487b6423e1e8, 0x91ce1a9a3d2cda62,
+           0x7641a140cc7810fb, 0xa9e904c87fcb0a9d, 0x546345fa9fbdcd44, 0xa97c177947ad4095,
+           0x49ed8eabcccc485d, 0x5c68f256bfff5a74, 0x73832eec6fff3111, 0xc831fd53c5ff7eab,
+           0xba3e7ca8b77f5e55, 0x28ce1bd2e55f35eb, 0x7980d163cf5b81b3, 0xd7e105bcc332621f,
+           0x8dd9472bf3fefaa7, 0xb14f98f6f0feb951, 0x6ed1bf9a569f33d3, 0x0a862f80ec4700c8,
+           0xcd27bb612758c0fa, 0x8038d51cb897789c, 0xe0470a63e6bd56c3, 0x1858ccfce06cac74,
+           0x0f37801e0c43ebc8, 0xd30560258f54e6ba, 0x47c6b82ef32a2069, 0x4cdc331d57fa5441,
+           0xe0133fe4adf8e952, 0x58180fddd97723a6, 0x570f09eaa7ea7648}};
+}
+
+constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_BASES> literal_compact_power_of_ten_high() {
+  return {{0xeef453d6923bd65a, 0xf148440a256e2c76, 0xf3a20279ed56d48a, 0xf6019da07f549b2b,
+           0xf867241c8cc6d4c0, 0xfad2a4b13d1b5d6c, 0xfd442e4688bd304a, 0xffbbcfe994e5c61f,
+           0x811ccc668829b887, 0x825ecc24c873782f, 0x83a3eeeef9153e89, 0x84ec3c97da624ab4,
+           0x8637bd05af6c69b5, 0x878678326eac9000, 0x88d8762bf324cd0f, 0x8a2dbf142dfcc7ab,
+           0x8b865b215899f46c, 0x8ce2529e2734bb1d, 0x8e41ade9fbebc27d, 0x8fa475791a569d10,
+           0x910ab1d4db9914a0, 0x92746b9be2f8552c, 0x93e1ab8252f33b45, 0x95527a5202df0ccb}};
+}
+
+constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_BASES> literal_compact_power_of_ten_low() {
+  return {{0x113faa2906a13b3f, 0xc00670ea43ca250d, 0x6b43527578c1110f, 0x7e2a53a146606a48,
+           0xc30163d203c94b62, 0x796b805720085f81, 0x908f4a166d1da663, 0xfdf17746497f7052,
+           0x0806357d5a3f525f, 0x8ed400668c0c28c8, 0x1953cf68300424ac, 0xbd5af13bef0b113e,
+           0xa63f9a49c2c1b110, 0x0000000000000000, 0xa5880a69fb6ac800, 0x6e3569326c784337,
+           0xbd79e0d20082ee74, 0x1899e4a65f58660c, 0x14588f13be847307, 0xf96e017d694487bc,
+           0x1d9c9892400a22a2, 0x32fd3cf5b4e49bb4, 0xcabb90e5c942b503, 0x0f37801e0c43ebc8}};
+}
+
+constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_STEP> literal_compact_powers_of_five() {
+  return {{0x0000000000000001, 0x0000000000000005, 0x0000000000000019, 0x000000000000007d,
+           0x0000000000000271, 0x0000000000000c35, 0x0000000000003d09, 0x000000000001312d,
+           0x000000000005f5e1, 0x00000000001dcd65, 0x00000000009502f9, 0x0000000002e90edd,
+           0x000000000e8d4a51, 0x0000000048c27395, 0x000000016bcc41e9, 0x000000071afd498d,
+           0x0000002386f26fc1, 0x000000b1a2bc2ec5, 0x000003782dace9d9, 0x00001158e460913d,
+           0x000056bc75e2d631, 0x0001b1ae4d6e2ef5, 0x000878678326eac9, 0x002a5a058fc295ed,
+           0x00d3c21bcecceda1, 0x0422ca8b0a00a425, 0x14adf4b7320334b9, 0x6765c793fa10079d}};
+}
+
+constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_CORRECTION_WORDS> literal_compact_power_of_ten_corrections() {
+  return {{0x0045101015155440, 0x0000000000050000, 0x4010000000001001, 0x0000000004504101,
+           0x1040110040010050, 0x0010004001044005, 0x0545444050140000, 0x9051556955455554,
+           0x0550955565955965, 0xaa95644114051514, 0x00000040a79aaaea, 0x0000000000000000,
+           0x0000000000000000, 0x0140105000141000, 0x5040155504440500, 0x0010555514545511,
+           0x9556641000110100, 0x44150504955555a5, 0x5465515550155514, 0x4000000500405555,
+           0x0000000000111041}};
+}
+#endif // FAST_DOUBLE_PARSER_GENERATED_TABLES
+
+// Every table the parsers read at run time, simd_double_parser included.
+// They are static members of a class template rather than namespace-scope
+// statics, of which each translation unit would get its own copy: like
+// C++17 inline variables, they are emitted at most once per program, and
+// only if used. The usual names below refer to them.
+template <class T = void>
+struct power_tables {
+  // 10^0 to 10^308 correctly rounded; the first 23 are exact and all the
+  // fast path needs, so the compact tables stop there.
+#if FAST_DOUBLE_PARSER_GENERATED_TABLES
+  static constexpr constexpr_array<double, FASTFLOAT_DOUBLE_POWERS> power_of_ten =
+      generate_double_powers_of_ten<1, FASTFLOAT_DOUBLE_POWERS>();
+#else
+  static constexpr constexpr_array<double, FASTFLOAT_DOUBLE_POWERS> power_of_ten = literal_power_of_ten();
+#endif
+#ifndef FAST_DOUBLE_PARSER_COMPACT_TABLES
+  // 10^-0 to 10^-308
+#if FAST_DOUBLE_PARSER_GENERATED_TABLES
+  static constexpr constexpr_array<double, 309> negative_power_of_ten = generate_double_powers_of_ten<-1, 309>();
+#else
+  static constexpr constexpr_array<double, 309> negative_power_of_ten = literal_negative_power_of_ten();
+#endif
+#endif
+
+  // max_mantissa_fast_path[x] is the largest i for which i * 10^x is still
+  // below 2^53, from x = 0 to x = 15.
+  static constexpr constexpr_array<uint64_t, 16> max_mantissa_fast_path = {
+      {9007199254740991, 900719925474099, 90071992547409, 9007199254740,
+       900719925474,     90071992547,     9007199254,     900719925,
+       90071992,         9007199,         900719,         90071,
+       9007,             900,             90,             9}};
+
+  // Powers of ten from 10^0 to 10^10. These can be represented exactly
+  // using the float type.
+  static constexpr constexpr_array<float, 11> power_of_ten_32 = {
+      {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f}};
+
+  // 10^0 to 10^19
+  static constexpr constexpr_array<uint64_t, 20> powers_of_ten_uint64 = {
+      {1ULL,
+       10ULL,
+       100ULL,
+       1000ULL,
+       10000ULL,
+       100000ULL,
+       1000000ULL,
+       10000000ULL,
+       100000000ULL,
+       1000000000ULL,
+       10000000000ULL,
+       100000000000ULL,
+       1000000000000ULL,
+       10000000000000ULL,
+       100000000000000ULL,
+       1000000000000000ULL,
+       10000000000000000ULL,
+       100000000000000000ULL,
+       1000000000000000000ULL,
+       10000000000000000000ULL}};
+
+  // The 128-bit mantissas of 10^FASTFLOAT_SMALLEST_POWER to
+  // 10^FASTFLOAT_LARGEST_POWER, as two dense arrays rather than an array of
+  // structs: power_of_ten_mantissa_64 holds the 64 most significant bits
+  // and is what a conversion reads; mantissa_128 holds the next 64 bits
+  // (see generate_mantissa_128) and is only read when the first 64 are not
+  // enough. Each takes 651 * 8 bytes, starting on a cache line. The binary
+  // exponent is not stored, see power_of_ten_exponent.
+#if FAST_DOUBLE_PARSER_GENERATED_TABLES
+  alignas(64) static constexpr constexpr_array<uint64_t, FASTFLOAT_MANTISSA_POWERS> power_of_ten_mantissa_64 =
+      generate_power_of_ten_mantissas<FASTFLOAT_SMALLEST_POWER, FASTFLOAT_LARGEST_POWER>();
+  alignas(64) static constexpr constexpr_array<uint64_t, FASTFLOAT_MANTISSA_POWERS> mantissa_128 =
+      generate_mantissa_128<FASTFLOAT_SMALLEST_POWER, FASTFLOAT_LARGEST_POWER>();
+
+  alignas(64) static constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_BASES> compact_power_of_ten_high =
+      generate_compact_power_of_ten_bases<true>();
+  static constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_BASES> compact_power_of_ten_low =
+      generate_compact_power_of_ten_bases<false>();
+  static constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_STEP> compact_powers_of_five =
+      generate_compact_powers_of_five();
+  static constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_CORRECTION_WORDS>
+      compact_power_of_ten_corrections = generate_compact_power_of_ten_corrections();
+#else
+  alignas(64) static constexpr constexpr_array<uint64_t, FASTFLOAT_MANTISSA_POWERS> power_of_ten_mantissa_64 =
+      literal_power_of_ten_mantissa_64();
+  alignas(64) static constexpr constexpr_array<uint64_t, FASTFLOAT_MANTISSA_POWERS> mantissa_128 =
+      literal_mantissa_128();
+
+  alignas(64) static constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_BASES> compact_power_of_ten_high =
+      literal_compact_power_of_ten_high();
+  static constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_BASES> compact_power_of_ten_low =
+      literal_compact_power_of_ten_low();
+  static constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_STEP> compact_powers_of_five =
+      literal_compact_powers_of_five();
+  static constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_CORRECTION_WORDS>
+      compact_power_of_ten_corrections = literal_compact_power_of_ten_corrections();
+#endif
+};
+
+// Since C++17 the members are inline and these definitions are redundant.
+#if __cplusplus < 201703L
+template <class T>
+constexpr constexpr_array<double, FASTFLOAT_DOUBLE_POWERS> power_tables<T>::power_of_ten;
+#ifndef FAST_DOUBLE_PARSER_COMPACT_TABLES
+template <class T>
+constexpr constexpr_array<double, 309> power_tables<T>::negative_power_of_ten;
+#endif
+template <class T>
+constexpr constexpr_array<uint64_t, 16> power_tables<T>::max_mantissa_fast_path;
+template <class T>
+constexpr constexpr_array<float, 11> power_tables<T>::power_of_ten_32;
+template <class T>
+constexpr constexpr_array<uint64_t, 20> power_tables<T>::powers_of_ten_uint64;
+template <class T>
+constexpr constexpr_array<uint64_t, FASTFLOAT_MANTISSA_POWERS> power_tables<T>::power_of_ten_mantissa_64;
+template <class T>
+constexpr constexpr_array<uint64_t, FASTFLOAT_MANTISSA_POWERS> power_tables<T>::mantissa_128;
+template <class T>
+constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_BASES> power_tables<T>::compact_power_of_ten_high;
+template <class T>
+constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_BASES> power_tables<T>::compact_power_of_ten_low;
+template <class T>
+constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_STEP> power_tables<T>::compact_powers_of_five;
+template <class T>
+constexpr constexpr_array<uint64_t, FASTFLOAT_COMPACT_POWER_CORRECTION_WORDS>
+    power_tables<T>::compact_power_of_ten_corrections;
+#endif
+
+static constexpr const auto &power_of_ten = power_tables<>::power_of_ten;
+#ifndef FAST_DOUBLE_PARSER_COMPACT_TABLES
+static constexpr const auto &negative_power_of_ten = power_tables<>::negative_power_of_ten;
+#endif
+static constexpr const auto &max_mantissa_fast_path = power_tables<>::max_mantissa_fast_path;
+static constexpr const auto &power_of_ten_32 = power_tables<>::power_of_ten_32;
+static constexpr const auto &powers_of_ten_uint64 = power_tables<>::powers_of_ten_uint64;
+static constexpr const auto &power_of_ten_mantissa_64 = power_tables<>::power_of_ten_mantissa_64;
+static constexpr const auto &mantissa_128 = power_tables<>::mantissa_128;
+static constexpr const auto &compact_power_of_ten_high = power_tables<>::compact_power_of_ten_high;
+static constexpr const auto &compact_power_of_ten_low = power_tables<>::compact_power_of_ten_low;
+static constexpr const auto &compact_powers_of_five = power_tables<>::compact_powers_of_five;
+static constexpr const auto &compact_power_of_ten_corrections = power_tables<>::compact_power_of_ten_corrections;
+
+// The 128-bit mantissa of 10^q, FASTFLOAT_SMALLEST_POWER <= q <=
+// FASTFLOAT_LARGEST_POWER, from the compact tables: the same bits as
+// power_of_ten_mantissa_64 and mantissa_128.
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 value128 compact_power_of_ten(int64_t q) {
+  const int64_t index = q - FASTFLOAT_SMALLEST_POWER;
+  const int64_t base = index / FASTFLOAT_COMPACT_POWER_STEP;
+  const int64_t r = index % FASTFLOAT_COMPACT_POWER_STEP;
+  if (r == 0) {
+    return value128{compact_power_of_ten_low[base], compact_power_of_ten_high[base]};
+  }
+  const uint64_t five = compact_powers_of_five[r];
+  const value128 high = full_multiplication(compact_power_of_ten_high[base], five);
+  const value128 low = full_multiplication(compact_power_of_ten_low[base], five);
+  // the 192-bit product is top:middle:low.low, and top is not zero as 5^r >= 5
+  const uint64_t middle = high.low + low.high;
+  const uint64_t top = high.high + (middle < high.low);
+  const int lz = leading_zeroes(top);
+  value128 answer{middle, top};
+  if (lz != 0) {
+    answer.high = (top << lz) | (middle >> (64 - lz));
+    answer.low = (middle << lz) | (low.low >> (64 - lz));
+  }
+  answer.low += (compact_power_of_ten_corrections[index / 32] >> (2 * (index % 32))) & 3;
+  return answer;
+}
+
+// 10^q rounded to the nearest double, -307 <= q <= 308, from the compact
+// tables; the same value as power_of_ten_to_double(q).
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 double compact_power_of_ten_to_double(int64_t q) {
+  const value128 p = compact_power_of_ten(q);
+  const uint64_t mantissa = p.high >> 11;
+  // 10^q is exactly halfway between two doubles only if its 128 bits are
+  // exact (0 <= q <= 55) and all zero past the rounding bit
+  const bool halfway = q >= 0 && q <= 55 && (p.high & 0x3ff) == 0 && p.low == 0;
+  const uint64_t round_up = ((p.high >> 10) & 1) & (halfway ? mantissa : 1);
+  // a mantissa rounded up to 2^53 carries into the exponent
+  const uint64_t bits = (uint64_t(power_of_ten_exponent(q) - 64) << 52) +
+                        (mantissa & ((uint64_t(1) << 52) - 1)) + round_up;
+  return bit_cast<double>(bits);
+}
+
+// The 64 most significant bits of the mantissa of 10^q, and the 64 bits
+// after them, from the full or (FAST_DOUBLE_PARSER_COMPACT_TABLES) the
+// compact tables.
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 uint64_t power_of_ten_high(int64_t q) {
+#ifdef FAST_DOUBLE_PARSER_COMPACT_TABLES
+  return compact_power_of_ten(q).high;
+#else
+  return power_of_ten_mantissa_64[q - FASTFLOAT_SMALLEST_POWER];
+#endif
+}
+
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 uint64_t power_of_ten_low(int64_t q) {
+#ifdef FAST_DOUBLE_PARSER_COMPACT_TABLES
+  return compact_power_of_ten(q).low;
+#else
+  return mantissa_128[q - FASTFLOAT_SMALLEST_POWER];
+#endif
+}
+
+// Define FAST_DOUBLE_PARSER_PREFETCH to have the parsers prefetch the
+// mantissa of 10^q as soon as q is known, so that a cold table miss
+// overlaps with the rest of the parse. Powers that Clinger's fast path
+// handles without the table are skipped. With warm tables this is only
+// an extra instruction, so it is off by default; the compact tables are
+// never prefetched.
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 void prefetch_power_of_ten(int64_t q) {
+#if defined(FAST_DOUBLE_PARSER_PREFETCH) && !defined(FAST_DOUBLE_PARSER_COMPACT_TABLES)
+  if (!is_constant_evaluated() && (q < -22 || q > 22) && q >= FASTFLOAT_SMALLEST_POWER &&
+      q <= FASTFLOAT_LARGEST_POWER) {
+    const uint64_t *line = &power_of_ten_mantissa_64[q - FASTFLOAT_SMALLEST_POWER];
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(reinterpret_cast<const char *>(line), _MM_HINT_T0);
+#elif !defined(_MSC_VER)
+    __builtin_prefetch(line);
+#else
+    (void)line;
+#endif
+  }
+#else
+  (void)q;
+#endif
+}
 
 // Attempts to compute i * 10^(power) exactly; and if "negative" is
 // true, negate the result.
-// This function will only work in some cases, when it does not work, success is
-// set to false. This should work *most of the time* (like 99% of the time).
+// The result is always correctly rounded, subnormals and zero included;
+// success is only set to false when the result is infinite.
 // We assume that power is in the [FASTFLOAT_SMALLEST_POWER,
 // FASTFLOAT_LARGEST_POWER] interval: the caller is responsible for this check.
-really_inline double compute_float_64(int64_t power, uint64_t i, bool negative,
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 double compute_float_64(int64_t power, uint64_t i, bool negative,
                                       bool *success) {
 
 /*
@@ -1123,7 +1342,8 @@ really_inline double compute_float_64(int64_t power, uint64_t i, bool negative,
 
   // possible, except if i == 0, so we handle i == 0 separately.
   if(i == 0) {
-    return 0.0;
+    *success = true;
+    return negative ? -0.0 : 0.0;
   }
 
   // we start with a fast path
@@ -1155,39 +1375,41 @@ really_inline double compute_float_64(int64_t power, uint64_t i, bool negative,
     *success = true;
     return d;
   }
-  // When 22 < power && power <  22 + 16, we could
-  // hope for another, secondary fast path.  It wa
+  // When 22 < power && power <  22 + 16, we have
+  // a secondary fast path.  It was
   // described by David M. Gay in  "Correctly rounded
   // binary-decimal and decimal-binary conversions." (1990)
   // If you need to compute i * 10^(22 + x) for x < 16,
   // first compute i * 10^x, if you know that result is exact
   // (e.g., when i * 10^x < 2^53),
   // then you can still proceed and do (i * 10^x) * 10^22.
-  // Is this worth your time?
-  // You need  22 < power *and* power <  22 + 16 *and* (i * 10^(x-22) < 2^53)
-  // for this second fast path to work.
-  // If you you have 22 < power *and* power <  22 + 16, and then you
-  // optimistically compute "i * 10^(x-22)", there is still a chance that you
-  // have wasted your time if i * 10^(x-22) >= 2^53. It makes the use cases of
-  // this optimization maybe less common than we would like. Source:
+  // We check i * 10^x < 2^53 before doing any work, by comparing i with
+  // max_mantissa_fast_path[x]. Source:
   // http://www.exploringbinary.com/fast-path-decimal-to-floating-point-conversion/
   // also used in RapidJSON: https://rapidjson.org/strtod_8h_source.html
+  if (22 < power && power <= 22 + 15 &&
+      i <= max_mantissa_fast_path[power - 22]) {
+    // both factors and their product are exact doubles, so only the final
+    // multiplication by 10^22 rounds
+    double d = double(i) * power_of_ten[power - 22];
+    d = d * power_of_ten[22];
+    if (negative) {
+      d = -d;
+    }
+    *success = true;
+    return d;
+  }
 
 
 
   // The fast path has now failed, so we are failing back on the slower path.
 
-  // In the slow path, we need to adjust i so that it is > 1<<63 which is always
-
   // We are going to need to do some 64-bit arithmetic to get a more precise product.
   // We use a table lookup approach.
-  components c =
-      power_of_ten_components[power - FASTFLOAT_SMALLEST_POWER]; // safe because
-                                                                 // power >= FASTFLOAT_SMALLEST_POWER
-                                                                 // and power <= FASTFLOAT_LARGEST_POWER
-  // we recover the mantissa of the power, it has a leading 1. It is always
-  // rounded down.
-  uint64_t factor_mantissa = c.mantissa;
+  // we recover the mantissa of the power, it has a leading 1.
+  uint64_t factor_mantissa = power_of_ten_high(power); // safe because
+                                                       // power >= FASTFLOAT_SMALLEST_POWER
+                                                       // and power <= FASTFLOAT_LARGEST_POWER
   // We want the most significant bit of i to be 1. Shift if needed.
   int lz = leading_zeroes(i);
   i <<= lz;
@@ -1205,32 +1427,18 @@ really_inline double compute_float_64(int64_t power, uint64_t i, bool negative,
   // know that we have an exact computed value for the leading
   // 55 bits because any imprecision would play out as a +1, in
   // the worst case.
-  // We expect this next branch to be rarely taken (say 1% of the time).
-  // When (upper & 0x1FF) == 0x1FF, it can be common for
-  // lower + i < lower to be true (proba. much higher than 1%).
-  if (unlikely((upper & 0x1FF) == 0x1FF) && (lower + i < lower)) {
-    uint64_t factor_mantissa_low =
-        mantissa_128[power - FASTFLOAT_SMALLEST_POWER];
-    // next, we compute the 64-bit x 128-bit multiplication, getting a 192-bit
-    // result (three 64-bit values)
-    product = full_multiplication(i, factor_mantissa_low);
-    uint64_t product_low = product.low;
-    uint64_t product_middle2 = product.high;
-    uint64_t product_middle1 = lower;
-    uint64_t product_high = upper;
-    uint64_t product_middle = product_middle1 + product_middle2;
-    if (product_middle < product_middle1) {
-      product_high++; // overflow carry
-    }
-    // we want to check whether mantissa *i + i would affect our result
-    // This does happen, e.g. with 7.3177701707893310e+15
-    if (((product_middle + 1 == 0) && ((product_high & 0x1FF) == 0x1FF) &&
-         (product_low + i < product_low))) { // let us be prudent and bail out.
-      *success = false;
-      return 0;
+  // Otherwise we refine the product with the next 64 bits of the power
+  // (mantissa_128), keeping the 128 most significant bits of the
+  // 192-bit product. Mushtak and Lemire ("Fast number parsing without
+  // fallback", 2023) checked every 64-bit i and every power in our
+  // range: those 128 bits always determine the correctly rounded result,
+  // so there is nothing left to bail out on.
+  if (unlikely((upper & 0x1FF) == 0x1FF)) {
+    value128 product_low = full_multiplication(i, power_of_ten_low(power));
+    lower += product_low.high;
+    if (product_low.high > lower) {
+      upper++; // overflow carry
     }
-    upper = product_high;
-    lower = product_middle;
   }
   // The final mantissa should be 53 bits with a leading 1.
   // We shift it so that it occupies 54 bits with a leading 1.
@@ -1239,33 +1447,40 @@ really_inline double compute_float_64(int64_t power, uint64_t i, bool negative,
   uint64_t mantissa = upper >> (upperbit + 9);
   lz += int(1 ^ upperbit);
   // Here we have mantissa < (1<<54).
+  int64_t real_exponent = power_of_ten_exponent(power) - lz;
+
+  if (unlikely(real_exponent <= 0)) {
+    // A subnormal: shift the mantissa to the fixed exponent of the
+    // subnormals, keeping one extra bit for rounding. Exact ties cannot
+    // happen this far from 10^0.
+    if (-real_exponent + 1 >= 64) {
+      *success = true;
+      return negative ? -0.0 : 0.0;
+    }
+    mantissa >>= -real_exponent + 1;
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    // Rounding up may give the smallest normal double (e.g.,
+    // 2.2250738585072013e-308): the carry lands in the exponent bit, and
+    // the bit pattern is right either way.
+    mantissa |= (((uint64_t)negative) << 63);
+    double d = bit_cast<double>(mantissa);
+    *success = true;
+    return d;
+  }
 
-  // We have to round to even. The "to even" part
-  // is only a problem when we are right in between two floats
-  // which we guard against.
-  // If we have lots of trailing zeros, we may fall right between two
-  // floating-point values.
-  if (unlikely((lower == 0) && ((upper & 0x1FF) == 0) &&
+  // We have to round to even. We normally round up on the extra bit, but
+  // if we are right in between two floats and the even one is below, we
+  // must round down. An exact tie needs i * 10^power to be exactly
+  // representable in 128 bits, which only happens when 5^|power| fits in
+  // 64 bits: -4 <= power <= 23 (e.g., 1e23). In that range the product is
+  // exact when lower <= 1, and we are in the middle if the bits we shifted
+  // out of upper are all zero.
+  if (unlikely((lower <= 1) && (power >= -4) && (power <= 23) &&
                ((mantissa & 3) == 1))) {
-      // if mantissa & 1 == 1 we might need to round up.
-      //
-      // Scenarios:
-      // 1. We are not in the middle. Then we should round up.
-      //
-      // 2. We are right in the middle. Whether we round up depends
-      // on the last significant bit: if it is "one" then we round
-      // up (round to even) otherwise, we do not.
-      //
-      // So if the last significant bit is 1, we can safely round up.
-      // Hence we only need to bail out if (mantissa & 3) == 1.
-      // Otherwise we may need more accuracy or analysis to determine whether
-      // we are exactly between two floating-point numbers.
-      // It can be triggered with 1e23.
-      // Note: because the factor_mantissa and factor_mantissa_low are
-      // almost always rounded down (except for small positive powers),
-      // almost always should round up.
-      *success = false;
-      return 0;
+    if ((mantissa << (upperbit + 9)) == upper) {
+      mantissa &= ~uint64_t(1); // we do not round up
+    }
   }
   mantissa += mantissa & 1;
   mantissa >>= 1;
@@ -1275,74 +1490,119 @@ really_inline double compute_float_64(int64_t power, uint64_t i, bool negative,
     // This will happen when parsing values such as 7.2057594037927933e+16
     ////////
     mantissa = (1ULL << 52);
-    lz--; // undo previous addition
+    real_exponent++;
   }
   mantissa &= ~(1ULL << 52);
-  uint64_t real_exponent = c.exp - lz;
-  // we have to check that real_exponent is in range, otherwise we bail out
-  if (unlikely((real_exponent < 1) || (real_exponent > 2046))) {
+  // past the largest double, we bail out
+  if (unlikely(real_exponent > 2046)) {
     *success = false;
     return 0;
   }
-  mantissa |= real_exponent << 52;
+  mantissa |= uint64_t(real_exponent) << 52;
   mantissa |= (((uint64_t)negative) << 63);
-  double d;
-  memcpy(&d, &mantissa, sizeof(d));
+  double d = bit_cast<double>(mantissa);
   *success = true;
   return d;
 }
 
-really_inline
-static bool parse_float_strtod(const char *&ptr, double *outDouble, const char *pend) {
-  char *endptr = (char *)pend;
-  *outDouble = strtod(ptr, &endptr);
-  // Some libraries will set errno = ERANGE when the value is subnormal,
-  // yet we may want to be able to parse subnormal values.
-  // However, we do not want to tolerate NAN or infinite values.
-  // There isno realistic application where you might need values so large than
-  // they can't fit in binary64. The maximal value is about  1.7976931348623157
-  // × 10^308 It is an unimaginable large number. There will never be any piece
-  // of engineering involving as many as 10^308 parts. It is estimated that
-  // there are about 10^80 atoms in the universe. The estimate for the total
-  // number of electrons is similar. Using a double-precision floating-point
-  // value, we can represent easily the number of atoms in the universe. We
-  // could  also represent the number of ways you can pick any three individual
-  // atoms at random in the universe.
-  if ((endptr == ptr) || (!std::isfinite(*outDouble))) {
-    return false;
+
+// Below 10^FASTFLOAT_SMALLEST_POWER_32, any 64-bit significand rounds to
+// zero as a float; above 10^FASTFLOAT_LARGEST_POWER_32, to infinity.
+#define FASTFLOAT_SMALLEST_POWER_32 -64
+#define FASTFLOAT_LARGEST_POWER_32 38
+
+// Same as compute_float_64, for a float result.
+// The result is always correctly rounded, subnormals and zero included;
+// success is only set to false when the result is infinite.
+// We assume that power is in the [FASTFLOAT_SMALLEST_POWER_32,
+// FASTFLOAT_LARGEST_POWER_32] interval: the caller is responsible for this
+// check.
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 float compute_float_32(int64_t power, uint64_t i, bool negative,
+                                     bool *success) {
+  uint32_t bits = uint32_t(negative) << 31;
+  *success = true;
+  if (i == 0) {
+    return bit_cast<float>(bits);
   }
-  ptr = endptr;
-  return true;
-}
 
-really_inline
-static bool parse_float_strtod(const wchar_t *&ptr, double *outDouble, const wchar_t*pend) {
-    wchar_t* endptr = (wchar_t *)pend;
-	*outDouble = wcstod(ptr, &endptr);
-	// Some libraries will set errno = ERANGE when the value is subnormal,
-	// yet we may want to be able to parse subnormal values.
-	// However, we do not want to tolerate NAN or infinite values.
-	// There isno realistic application where you might need values so large than
-	// they can't fit in binary64. The maximal value is about  1.7976931348623157
-	// × 10^308 It is an unimaginable large number. There will never be any piece
-	// of engineering involving as many as 10^308 parts. It is estimated that
-	// there are about 10^80 atoms in the universe. The estimate for the total
-	// number of electrons is similar. Using a double-precision floating-point
-	// value, we can represent easily the number of atoms in the universe. We
-	// could  also represent the number of ways you can pick any three individual
-	// atoms at random in the universe.
-	if ((endptr == ptr) || (!std::isfinite(*outDouble))) {
-		return false;
-	}
-	ptr = endptr;
-	return true;
+  // Clinger's fast path: 0 <= i < 2^24 and 10^|power| are exact floats, so
+  // a single multiplication or division is correctly rounded.
+  if (-10 <= power && power <= 10 && i <= 16777215) {
+    float f = float(i);
+    if (power < 0) {
+      f = f / power_of_ten_32[-power];
+    } else {
+      f = f * power_of_ten_32[power];
+    }
+    return negative ? -f : f;
+  }
+
+  // the float range is a slice of the same table
+  uint64_t factor_mantissa = power_of_ten_high(power);
+  int lz = leading_zeroes(i);
+  i <<= lz;
+  value128 product = full_multiplication(i, factor_mantissa);
+  uint64_t lower = product.low;
+  uint64_t upper = product.high;
+  // We only keep 26 bits of upper (24 bits, a rounding bit and maybe a
+  // leading zero), so the product is exact unless the other 38 bits are all
+  // ones. Then we refine it with mantissa_128, as in compute_float_64.
+  if (unlikely((upper & 0x3FFFFFFFFF) == 0x3FFFFFFFFF)) {
+    value128 product_low = full_multiplication(i, power_of_ten_low(power));
+    lower += product_low.high;
+    if (product_low.high > lower) {
+      upper++; // overflow carry
+    }
+  }
+  uint64_t upperbit = upper >> 63;
+  uint64_t mantissa = upper >> (upperbit + 38);
+  // 10^power is (mantissa of the table) * 2^(power2 - 63), and 127 is the
+  // exponent bias of the float type
+  int32_t power2 = power_of_ten_exponent(power) - 1024;
+  int32_t real_exponent = power2 + int32_t(upperbit) - lz + 127;
+
+  if (real_exponent <= 0) {
+    // A subnormal. Ties cannot happen this far from 10^0.
+    if (-real_exponent + 1 >= 64) {
+      return bit_cast<float>(bits);
+    }
+    mantissa >>= -real_exponent + 1;
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    // rounding up may give the smallest normal float, whose exponent bit
+    // is exactly the bit that overflowed out of the mantissa
+    bits |= uint32_t(mantissa);
+    return bit_cast<float>(bits);
+  }
+
+  // Round to even, as in compute_float_64; for floats, exact ties need
+  // -17 <= power <= 10.
+  if (unlikely((lower <= 1) && (power >= -17) && (power <= 10) &&
+               ((mantissa & 3) == 1))) {
+    if ((mantissa << (upperbit + 38)) == upper) {
+      mantissa &= ~uint64_t(1); // we do not round up
+    }
+  }
+  mantissa += mantissa & 1;
+  mantissa >>= 1;
+  if (mantissa >= (1ULL << 24)) {
+    mantissa = (1ULL << 23);
+    real_exponent++;
+  }
+  mantissa &= ~(1ULL << 23);
+  if (unlikely(real_exponent >= 0xFF)) {
+    *success = false;
+    return 0;
+  }
+  bits |= uint32_t(mantissa) | (uint32_t(real_exponent) << 23);
+  return bit_cast<float>(bits);
 }
 
 #if ( __cplusplus < 201703L )
 template <class _Char, _Char First, _Char... Rest>
 struct one_of_impl
 {
-  really_inline static bool call(_Char v)
+  really_inline static FAST_DOUBLE_PARSER_CONSTEXPR20 bool call(_Char v)
   {
     return First == v || one_of_impl<_Char, Rest...>::call(v);
   }
@@ -1350,166 +1610,822 @@ struct one_of_impl
 template<class _Char, _Char First>
 struct one_of_impl<_Char, First>
 {
-  really_inline static bool call(_Char v)
+  really_inline static FAST_DOUBLE_PARSER_CONSTEXPR20 bool call(_Char v)
   {
     return First == v;
   }
 };
 template <class _Char, _Char... Values>
-really_inline bool is_one_of(_Char v)
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool is_one_of(_Char v)
 {
   return one_of_impl<_Char, Values...>::call(v);
 }
 #else
 template <class _Char, _Char... Values>
-really_inline bool is_one_of(_Char v)
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool is_one_of(_Char v)
 {
   return ((v == Values) || ...);
 }
 #endif
 
 
-// parse the number at p
+// The slow path. compute_float_64 needs the significant digits to fit in
+// 64 bits and the result to be a normal double. For everything else we
+// follow fast_float's digit comparison: estimate the result from the first
+// 19 digits, then decide the rounding by comparing all the decimal digits
+// against the halfway point between two neighbouring doubles, with big
+// integers on the stack. There is no heap allocation and no call into libc,
+// so the result does not depend on the locale.
+// The same code serves floats: binary_format holds what differs.
+
+template <class T> struct binary_format;
+
+template <> struct binary_format<double> {
+  typedef uint64_t bits_type;
+  static constexpr int mantissa_explicit_bits() { return 52; }
+  static constexpr int exponent_bias() { return 1023; }
+  static constexpr int32_t infinite_power() { return 0x7FF; }
+  static constexpr int64_t smallest_power_of_ten() { return FASTFLOAT_SMALLEST_POWER; }
+  static constexpr int64_t largest_power_of_ten() { return FASTFLOAT_LARGEST_POWER; }
+  static really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 double compute_float(int64_t power, uint64_t i, bool negative, bool *success) {
+    return compute_float_64(power, i, negative, success);
+  }
+};
+
+template <> struct binary_format<float> {
+  typedef uint32_t bits_type;
+  static constexpr int mantissa_explicit_bits() { return 23; }
+  static constexpr int exponent_bias() { return 127; }
+  static constexpr int32_t infinite_power() { return 0xFF; }
+  static constexpr int64_t smallest_power_of_ten() { return FASTFLOAT_SMALLEST_POWER_32; }
+  static constexpr int64_t largest_power_of_ten() { return FASTFLOAT_LARGEST_POWER_32; }
+  static really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 float compute_float(int64_t power, uint64_t i, bool negative, bool *success) {
+    return compute_float_32(power, i, negative, success);
+  }
+};
+
+// A double (or float) before it is packed: the mantissa without its
+// implicit bit and the biased binary exponent (0 for subnormals,
+// infinite_power() for infinity).
+// compute_error returns the unrounded 64-bit product instead, with power2
+// shifted down by FASTFLOAT_INVALID_AM_BIAS.
+struct adjusted_mantissa {
+  uint64_t mantissa;
+  int32_t power2;
+};
+
+#define FASTFLOAT_INVALID_AM_BIAS -0x8000
+// Beyond this many significant digits, the remaining digits can only
+// matter through whether they are all zero (see parse_big_mantissa).
+#define FASTFLOAT_MAX_DIGITS 769
+
+// A fixed-size unsigned big integer, with 64-bit limbs in little-endian
+// order. The top limb is never zero. 62 limbs are enough for any
+// comparison the slow path makes.
+struct bigint {
+  static const size_t max_limbs = 62;
+  uint64_t limbs[max_limbs];
+  size_t length;
+
+  FAST_DOUBLE_PARSER_CONSTEXPR20 bigint() : length(0) {}
+  explicit FAST_DOUBLE_PARSER_CONSTEXPR20 bigint(uint64_t value) : length(value != 0) { limbs[0] = value; }
+
+  // this = this * y + add
+  really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool mul_add(uint64_t y, uint64_t add) {
+    uint64_t carry = add;
+    for (size_t i = 0; i < length; i++) {
+      value128 z = full_multiplication(limbs[i], y);
+      uint64_t low = z.low + carry;
+      carry = z.high + (low < z.low);
+      limbs[i] = low;
+    }
+    if (carry != 0) {
+      if (length == max_limbs) {
+        return false;
+      }
+      limbs[length++] = carry;
+    }
+    return true;
+  }
+
+  // this = this * 2^n
+  FAST_DOUBLE_PARSER_CONSTEXPR20 bool pow2(uint32_t n) {
+    if (length == 0) {
+      return true;
+    }
+    uint32_t bits = n % 64;
+    size_t words = n / 64;
+    if (bits != 0) {
+      uint64_t prev = 0;
+      for (size_t i = 0; i < length; i++) {
+        uint64_t x = limbs[i];
+        limbs[i] = (x << bits) | prev;
+        prev = x >> (64 - bits);
+      }
+      if (prev != 0) {
+        if (length == max_limbs) {
+          return false;
+        }
+        limbs[length++] = prev;
+      }
+    }
+    if (words != 0) {
+      if (length + words > max_limbs) {
+        return false;
+      }
+      if (is_constant_evaluated()) {
+        for (size_t i = length; i-- > 0;) {
+          limbs[i + words] = limbs[i];
+        }
+        for (size_t i = 0; i < words; i++) {
+          limbs[i] = 0;
+        }
+      } else {
+        memmove(limbs + words, limbs, length * sizeof(uint64_t));
+        memset(limbs, 0, words * sizeof(uint64_t));
+      }
+      length += words;
+    }
+    return true;
+  }
+
+  // this = this * 5^n, 5^27 being the largest power of five in 64 bits
+  FAST_DOUBLE_PARSER_CONSTEXPR20 bool pow5(uint32_t n) {
+    const uint64_t five_27 = 7450580596923828125ULL;
+    for (; n >= 27; n -= 27) {
+      if (!mul_add(five_27, 0)) {
+        return false;
+      }
+    }
+    uint64_t small = 1;
+    for (; n > 0; n--) {
+      small *= 5;
+    }
+    return mul_add(small, 0);
+  }
+
+  FAST_DOUBLE_PARSER_CONSTEXPR20 bool pow10(uint32_t n) { return pow5(n) && pow2(n); }
+
+  FAST_DOUBLE_PARSER_CONSTEXPR20 int compare(const bigint &other) const {
+    if (length != other.length) {
+      return length > other.length ? 1 : -1;
+    }
+    for (size_t i = length; i > 0; i--) {
+      if (limbs[i - 1] != other.limbs[i - 1]) {
+        return limbs[i - 1] > other.limbs[i - 1] ? 1 : -1;
+      }
+    }
+    return 0;
+  }
+
+  FAST_DOUBLE_PARSER_CONSTEXPR20 int bit_length() const {
+    return length == 0 ? 0 : int(64 * length) - leading_zeroes(limbs[length - 1]);
+  }
+
+  // the 64 most significant bits, normalized so that the top bit is set;
+  // truncated tells whether any lower bit is non-zero
+  FAST_DOUBLE_PARSER_CONSTEXPR20 uint64_t hi64(bool &truncated) const {
+    truncated = false;
+    if (length == 0) {
+      return 0;
+    }
+    uint64_t r0 = limbs[length - 1];
+    int shift = leading_zeroes(r0);
+    if (length == 1) {
+      return r0 << shift;
+    }
+    uint64_t r1 = limbs[length - 2];
+    uint64_t hi = r0;
+    if (shift == 0) {
+      truncated = r1 != 0;
+    } else {
+      truncated = (r1 << shift) != 0;
+      hi = (r0 << shift) | (r1 >> (64 - shift));
+    }
+    for (size_t i = length - 2; i > 0 && !truncated; i--) {
+      truncated = limbs[i - 1] != 0;
+    }
+    return hi;
+  }
+};
+
+// The unrounded product of w and 10^q, with its binary exponent biased by
+// FASTFLOAT_INVALID_AM_BIAS. The true value of w * 10^q lies within one
+// unit of the last place of this mantissa.
+template <class T>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 adjusted_mantissa compute_error(int64_t q, uint64_t w) {
+  int lz = leading_zeroes(w);
+  w <<= lz;
+  value128 product = full_multiplication(w, power_of_ten_high(q));
+  if ((product.high & 0x1FF) == 0x1FF) {
+    value128 product_low = full_multiplication(w, power_of_ten_low(q));
+    uint64_t lower = product.low + product_low.high;
+    if (product_low.high > lower) {
+      product.high++;
+    }
+  }
+  int hilz = int(product.high >> 63) ^ 1;
+  adjusted_mantissa answer;
+  answer.mantissa = product.high << hilz;
+  // power_of_ten_exponent(q) - 1024 is the binary exponent of 10^q for a
+  // 64-bit mantissa;
+  // bias (1075 = 52 + 1023 for doubles) turns it into a biased exponent
+  // for a 53-bit one
+  const int32_t bias = binary_format<T>::mantissa_explicit_bits() + binary_format<T>::exponent_bias();
+  answer.power2 = int32_t(power_of_ten_exponent(q) - 1024 + bias - hilz - lz - 62 + FASTFLOAT_INVALID_AM_BIAS);
+  return answer;
+}
+
+// Rounding callbacks for round_extended: given the bits about to be
+// shifted out, decide whether to round the mantissa up.
+struct round_down_rule {
+  really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool operator()(bool, bool, bool) const { return false; }
+};
+
+// nearest, ties to even; truncated means that there were non-zero bits
+// below those we can see, so an apparent tie is really above halfway
+struct round_nearest_rule {
+  bool truncated;
+  really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool operator()(bool is_odd, bool is_halfway, bool is_above) const {
+    return is_above || (is_halfway && truncated) || (is_odd && is_halfway);
+  }
+};
+
+// the rounding direction comes from comparing the input with the halfway
+// point: ord > 0 above it, ord < 0 below it, 0 exactly on it
+struct round_by_order_rule {
+  int ord;
+  really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool operator()(bool is_odd, bool, bool) const {
+    return ord > 0 || (ord == 0 && is_odd);
+  }
+};
+
+// Shift the 64-bit extended mantissa down to 53 bits (24 for floats, fewer
+// for subnormals), rounding as the rule says, and fix up the exponent.
+template <class T, class _Rule>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 void round_extended(adjusted_mantissa &am, _Rule rule) {
+  const int mbits = binary_format<T>::mantissa_explicit_bits();
+  const int32_t mantissa_shift = 64 - mbits - 1;
+  int32_t shift = mantissa_shift;
+  bool subnormal = -am.power2 >= mantissa_shift;
+  if (subnormal) {
+    shift = -am.power2 + 1;
+    if (shift > 64) {
+      shift = 64;
+    }
+  }
+  uint64_t mask = (shift == 64) ? UINT64_MAX : (uint64_t(1) << shift) - 1;
+  uint64_t halfway = (shift == 0) ? 0 : uint64_t(1) << (shift - 1);
+  uint64_t truncated_bits = am.mantissa & mask;
+  bool is_above = truncated_bits > halfway;
+  bool is_halfway = truncated_bits == halfway;
+  am.mantissa = (shift == 64) ? 0 : am.mantissa >> shift;
+  am.power2 += shift;
+  bool is_odd = (am.mantissa & 1) == 1;
+  am.mantissa += uint64_t(rule(is_odd, is_halfway, is_above));
+
+  if (subnormal) {
+    // rounding may have carried into the implicit bit: a normal number
+    am.power2 = (am.mantissa < (uint64_t(1) << mbits)) ? 0 : 1;
+    am.mantissa &= ~(uint64_t(1) << mbits);
+    return;
+  }
+  if (am.mantissa >= (uint64_t(2) << mbits)) {
+    am.mantissa = (uint64_t(1) << mbits);
+    am.power2++;
+  }
+  am.mantissa &= ~(uint64_t(1) << mbits);
+  if (am.power2 >= binary_format<T>::infinite_power()) {
+    am.power2 = binary_format<T>::infinite_power();
+    am.mantissa = 0;
+  }
+}
+
+template <class T>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 T to_binary(bool negative, adjusted_mantissa am) {
+  typedef typename binary_format<T>::bits_type bits_type;
+  bits_type bits = bits_type(am.mantissa) |
+                   (bits_type(am.power2) << binary_format<T>::mantissa_explicit_bits()) |
+                   (bits_type(negative) << (sizeof(T) * 8 - 1));
+  return bit_cast<T>(bits);
+}
+
+// Value is bigmant * 10^exponent with exponent >= 0: the big integer holds
+// the exact value and we can round it directly.
+template <class T>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 adjusted_mantissa positive_digit_comp(bigint &bigmant, int32_t exponent) {
+  bool ok = bigmant.pow10(uint32_t(exponent));
+  assert(ok);
+  (void)ok;
+  adjusted_mantissa answer;
+  round_nearest_rule rule;
+  answer.mantissa = bigmant.hi64(rule.truncated);
+  answer.power2 = bigmant.bit_length() - 64 + binary_format<T>::mantissa_explicit_bits() +
+                  binary_format<T>::exponent_bias();
+  round_extended<T>(answer, rule);
+  return answer;
+}
+
+// Value is bigmant * 10^exponent with exponent < 0. Round the estimate am
+// down to a double b, then compare bigmant * 10^exponent with b + h, the
+// halfway point to the next double, after scaling both to integers.
+template <class T>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 adjusted_mantissa negative_digit_comp(bigint &bigmant, adjusted_mantissa am, int32_t exponent) {
+  const int32_t bias = binary_format<T>::mantissa_explicit_bits() + binary_format<T>::exponent_bias();
+  adjusted_mantissa b = am;
+  round_extended<T>(b, round_down_rule());
+  // b + h, as a 54-bit mantissa (25-bit for floats) and a power of two
+  uint64_t theor_mantissa = b.mantissa;
+  int32_t theor_exp;
+  if (b.power2 == 0) {
+    theor_exp = 1 - bias;
+  } else {
+    theor_mantissa |= uint64_t(1) << binary_format<T>::mantissa_explicit_bits();
+    theor_exp = b.power2 - bias;
+  }
+  theor_mantissa = (theor_mantissa << 1) + 1;
+  theor_exp -= 1;
+
+  bigint theor_digits(theor_mantissa);
+  int32_t pow2_exp = theor_exp - exponent;
+  bool ok = theor_digits.pow5(uint32_t(-exponent));
+  if (pow2_exp > 0) {
+    ok = ok && theor_digits.pow2(uint32_t(pow2_exp));
+  } else if (pow2_exp < 0) {
+    ok = ok && bigmant.pow2(uint32_t(-pow2_exp));
+  }
+  assert(ok);
+  (void)ok;
+
+  round_by_order_rule rule;
+  rule.ord = bigmant.compare(theor_digits);
+  adjusted_mantissa answer = am;
+  round_extended<T>(answer, rule);
+  return answer;
+}
+
+// The characters that may separate the integer part from the fraction.
+// decimal_separators<char, '.', ','> accepts both; the separators are
+// converted to the input character type before the comparison.
+template <class _Sep, _Sep... Seps>
+struct decimal_separators;
+
+template <class _Sep>
+struct decimal_separators<_Sep> {
+  template <class _Char>
+  really_inline static FAST_DOUBLE_PARSER_CONSTEXPR20 bool contains(_Char) {
+    return false;
+  }
+};
+
+template <class _Sep, _Sep First, _Sep... Rest>
+struct decimal_separators<_Sep, First, Rest...> {
+  template <class _Char>
+  really_inline static FAST_DOUBLE_PARSER_CONSTEXPR20 bool contains(_Char c) {
+    return c == _Char(First) || decimal_separators<_Sep, Rest...>::contains(c);
+  }
+};
+
+// A parse policy fixes the grammar of the decimal scanner at compile time.
+// Every branch that depends on it folds away, so a parser only pays for the
+// syntax it accepts. A policy is a struct with these members:
+//   leading_plus    "+1" is 1
+//   leading_zeros   "0123" is 123 (otherwise a 0 cannot be followed by a
+//                   digit, and parsing stops with an error)
+//   leading_point   ".5" is 0.5
+//   trailing_point  "5." is 5.0
+//   exponent_char   the exponent marker, matched in either case
+//   separators      a decimal_separators list
+//   group_separator digit grouping in the integer part ("1,234,567"), or 0
+//                   for none. The first group has one to three digits, all
+//                   the others exactly three; ungrouped integers are fine
+//                   too. It must not also be a decimal separator.
+// There is always at least one digit, and a sign is always followed by the
+// number itself.
+
+// Numbers as RFC 8259 (and RFC 7159 before it) spells them.
+struct json_policy {
+  static constexpr bool leading_plus = false;
+  static constexpr bool leading_zeros = false;
+  static constexpr bool leading_point = false;
+  static constexpr bool trailing_point = false;
+  static constexpr char exponent_char = 'e';
+  typedef decimal_separators<char, '.'> separators;
+  static constexpr char group_separator = 0;
+};
+
+// What strtod reads in the C locale, minus the spaces, inf, nan and hex
+// (see parse_hex_base for the latter).
+struct strtod_policy {
+  static constexpr bool leading_plus = true;
+  static constexpr bool leading_zeros = true;
+  static constexpr bool leading_point = true;
+  static constexpr bool trailing_point = true;
+  static constexpr char exponent_char = 'e';
+  typedef decimal_separators<char, '.'> separators;
+  static constexpr char group_separator = 0;
+};
+
+// Hand-edited spreadsheet exports: anything strtod takes, with either
+// decimal separator.
+struct csv_policy : strtod_policy {
+  typedef decimal_separators<char, '.', ','> separators;
+};
+
+// The grammar of parse_number_base and its siblings: a leading + is fine,
+// but there must be digits on both sides of the separator, and no leading
+// zero.
 template <class _Char, _Char... DecSeparators>
-WARN_UNUSED
-bool parse_number_base(const _Char*&pinit, double *outDouble, const _Char* pend) {
-  typedef typename std::make_unsigned<_Char>::type _Uchar;
-  const _Char*p = pinit;
-  bool found_minus = (*p == '-');
-  bool negative = false;
-  bool is_double = false;
-  bool is_overflow = false;
+struct separator_policy {
+  static constexpr bool leading_plus = true;
+  static constexpr bool leading_zeros = false;
+  static constexpr bool leading_point = false;
+  static constexpr bool trailing_point = false;
+  static constexpr char exponent_char = 'e';
+  typedef decimal_separators<_Char, DecSeparators...> separators;
+  static constexpr char group_separator = 0;
+};
+
+// Report and spreadsheet exports with thousands separators:
+// digit_grouping_policy<',', '.'> reads "1,234,567.89" and
+// digit_grouping_policy<'.', ','> reads "1.234.567,89". Otherwise the
+// grammar of parse_number_base.
+template <char GroupSeparator, char DecimalSeparator>
+struct digit_grouping_policy : separator_policy<char, DecimalSeparator> {
+  static constexpr char group_separator = GroupSeparator;
+};
+
+// true if c starts the exponent under Policy
+template <class Policy, class _Char>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool is_exponent_char(_Char c) {
+  return (c | 32) == (Policy::exponent_char | 32);
+}
 
-  if (found_minus) {
+// true if c is the group separator of Policy (never, without grouping)
+template <class Policy, class _Char>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool is_group_separator(_Char c) {
+  return Policy::group_separator != 0 && c == _Char(Policy::group_separator);
+}
+
+// Correctly rounded value of the decimal number in [p, pend). The caller
+// has already checked the syntax under Policy: an optional sign, digits
+// (with group separators, which are skipped where the digits are read)
+// with at most one decimal separator, and an optional exponent. Overflow
+// gives infinity and underflow a signed zero, as with strtod (strtof for
+// T = float).
+template <class T, class Policy, class _Char>
+disable_inline FAST_DOUBLE_PARSER_CONSTEXPR20 T parse_float_slow(const _Char *p, const _Char *pend) {
+  bool negative = false;
+  if (p < pend && (*p == '-' || *p == '+')) {
+    negative = *p == '-';
     ++p;
-    negative = true;
-    if (p >= pend || !is_integer(*p)) { // a negative sign must be followed by an integer
-      pinit = p;
-      return false;
+  }
+  const _Char *const int_begin = p;
+  while (p < pend && (is_integer(*p) || is_group_separator<Policy>(*p))) {
+    ++p;
+  }
+  const _Char *const int_end = p;
+  const _Char *frac_begin = p;
+  if (p < pend && Policy::separators::contains(*p)) {
+    ++p;
+    frac_begin = p;
+    while (p < pend && is_integer(*p)) {
+      ++p;
     }
   }
-  else if (*p == '+') {
+  const _Char *const frac_end = p;
+  int64_t exponent = 0;
+  if (p < pend && is_exponent_char<Policy>(*p)) {
     ++p;
-	if (p >= pend || !is_integer(*p)) { // a negative sign must be followed by an integer
-		pinit = p;
-		return false;
-	}
+    bool neg_exp = false;
+    if (p < pend && (*p == '-' || *p == '+')) {
+      neg_exp = *p == '-';
+      ++p;
+    }
+    for (; p < pend && is_integer(*p); ++p) {
+      if (exponent < 0x10000000) { // far beyond any double either way
+        exponent = 10 * exponent + (*p - '0');
+      }
+    }
+    if (neg_exp) {
+      exponent = -exponent;
+    }
   }
+  exponent -= int64_t(frac_end - frac_begin);
 
-  const _Char *const start_digits = p;
+  // Skip the leading zeros, then read the first 19 significant digits
+  // into w. The digits are the integer span followed by the fraction span.
+  const _Char *spans[2][2] = {{int_begin, int_end}, {frac_begin, frac_end}};
+  int s = 0;
+  for (; s < 2; s++) {
+    while (spans[s][0] != spans[s][1] && (*spans[s][0] == '0' || is_group_separator<Policy>(*spans[s][0]))) {
+      ++spans[s][0];
+    }
+    if (spans[s][0] != spans[s][1]) {
+      break;
+    }
+  }
+  if (s == 2) { // only zeros
+    return negative ? -T(0) : T(0);
+  }
+  int64_t digits = int64_t(spans[0][1] - spans[0][0]) + int64_t(spans[1][1] - spans[1][0]);
+  if (Policy::group_separator != 0) {
+    for (const _Char *d = spans[0][0]; d != spans[0][1]; ++d) {
+      digits -= is_group_separator<Policy>(*d);
+    }
+  }
+  uint64_t w = 0;
+  int64_t w_digits = 0;
+  for (int t = 0; t < 2 && w_digits < 19; t++) {
+    for (const _Char *d = spans[t][0]; d != spans[t][1] && w_digits < 19; ++d) {
+      if (!is_group_separator<Policy>(*d)) {
+        w = 10 * w + uint64_t(*d - '0');
+        ++w_digits;
+      }
+    }
+  }
 
-  uint64_t i;      // an unsigned int avoids signed overflows (which are bad)
-  if (*p == '0') { // 0 cannot be followed by an integer
+  adjusted_mantissa am;
+  // w * 10^q is the value truncated to 19 significant digits
+  int64_t q = exponent + (digits - w_digits);
+  if (q < binary_format<T>::smallest_power_of_ten()) {
+    am.mantissa = 0;
+    am.power2 = 0;
+    return to_binary<T>(negative, am);
+  }
+  if (q > binary_format<T>::largest_power_of_ten()) {
+    am.mantissa = 0;
+    am.power2 = binary_format<T>::infinite_power();
+    return to_binary<T>(negative, am);
+  }
+  am = compute_error<T>(q, w);
+  am.power2 -= FASTFLOAT_INVALID_AM_BIAS;
+
+  // Now all the digits, up to FASTFLOAT_MAX_DIGITS, into bigmant, 19 at
+  // a time (eight at a time when they fit the SWAR helpers).
+  bigint bigmant;
+  uint64_t value = 0;
+  size_t counter = 0;
+  int64_t big_digits = 0;
+  bool big_truncated = false;
+  for (int t = 0; t < 2; t++) {
+    const _Char *d = spans[t][0];
+    const _Char *const end = spans[t][1];
+    while (d != end && big_digits < FASTFLOAT_MAX_DIGITS) {
+      if (is_group_separator<Policy>(*d)) {
+        ++d;
+        continue;
+      }
+      if (counter <= 11 && big_digits <= FASTFLOAT_MAX_DIGITS - 8 && parse_eight_digits(d, end, value)) {
+        d += 8;
+        counter += 8;
+        big_digits += 8;
+      } else {
+        value = 10 * value + uint64_t(*d - '0');
+        ++d;
+        counter++;
+        big_digits++;
+      }
+      if (counter == 19) {
+        bigmant.mul_add(powers_of_ten_uint64[19], value);
+        counter = 0;
+        value = 0;
+      }
+    }
+    for (; d != end && !big_truncated; ++d) {
+      big_truncated = *d != '0' && !is_group_separator<Policy>(*d);
+    }
+  }
+  if (counter != 0) {
+    bigmant.mul_add(powers_of_ten_uint64[counter], value);
+  }
+
+  // bigmant * 10^big_exp is the value; if we had to drop non-zero digits,
+  // append a 1 so that the input cannot look like an exact halfway point
+  int64_t big_exp = exponent + (digits - big_digits);
+  if (big_truncated) {
+    bigmant.mul_add(10, 1);
+    big_exp--;
+  }
+  if (big_exp >= 0) {
+    am = positive_digit_comp<T>(bigmant, int32_t(big_exp));
+  } else {
+    am = negative_digit_comp<T>(bigmant, am, int32_t(big_exp));
+  }
+  return to_binary<T>(negative, am);
+}
+
+// An all-ones exponent is infinity (std::isfinite is constexpr only since
+// C++23). The parsers never produce a NaN.
+template <class T>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool is_infinite(T d) {
+  typedef typename binary_format<T>::bits_type bits_type;
+  const bits_type exponent = bit_cast<bits_type>(d) >> binary_format<T>::mantissa_explicit_bits();
+  return (exponent & bits_type(binary_format<T>::infinite_power())) == bits_type(binary_format<T>::infinite_power());
+}
+
+// Slow path of parse_number_base for the token [pinit, pend). Like the
+// strtod fallback it replaces, it refuses values that overflow.
+template <class T, class Policy, class _Char>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_float_fallback(const _Char *&pinit, T *outDouble, const _Char *pend) {
+  T d = parse_float_slow<T, Policy>(pinit, pend);
+  if (is_infinite(d)) {
+    return false;
+  }
+  *outDouble = d;
+  pinit = pend;
+  return true;
+}
+
+// Skips the optional sign at p (p < pend). Returns false if there is a
+// sign that is not followed by a digit.
+template <bool _Padded = false, class _Char>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_sign(const _Char *&p, const _Char *pend, bool &negative) {
+  negative = (*p == '-');
+  if (negative || *p == '+') {
     ++p;
-    if (p < pend && is_integer(*p)) {
-      pinit = p;
-      return false;
+    return before_end<_Padded>(p, pend) && is_integer(*p);
+  }
+  return true;
+}
+
+// A decimal number before any binary conversion: mantissa * 10^exponent.
+// When there are more than 19 significant digits (20 for an integer below
+// 2^64), only the first 19 stay in mantissa; the others are counted in the
+// exponent, and truncated tells whether any of them was not a zero.
+// parse_number_base fills one in for decimal-native consumers (decimal64
+// storage, say), without going near the power tables.
+struct decimal_components {
+  uint64_t mantissa;
+  int64_t exponent;
+  bool negative;
+  bool truncated;
+};
+
+// Scans the number at p into out and moves p past it (or to the error).
+// With _Padded, the input follows the contract of parse_number_padded_base.
+// Returns result_type::Long for an integer that fits in out.mantissa (the
+// exponent is then 0), result_type::Double for any other number, and
+// result_type::Invalid.
+template <bool _Padded, class Policy, class _Char>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 result_type scan_number(const _Char *&p, decimal_components &out, const _Char *pend) {
+  typedef typename std::make_unsigned<_Char>::type _Uchar;
+  bool is_double = false;
+  bool is_overflow = false;
+  bool truncated = false;
+  int64_t exponent = 0;
+
+  if (!before_end<_Padded>(p, pend)) { // an empty span: do not even look at *p
+    return result_type::Invalid;
+  }
+  const bool negative = (*p == '-');
+  if (negative || (Policy::leading_plus && *p == '+')) {
+    ++p;
+    if (!before_end<_Padded>(p, pend)) {
+      return result_type::Invalid;
+    }
+  }
+
+  uint64_t i = 0;  // an unsigned int avoids signed overflows (which are bad)
+  int64_t groups = 0; // group separators in the integer part
+  const _Char *const start_integer = p;
+  const _Char *start_digits = p;
+  if (*p == '0' && !Policy::leading_zeros) {
+    ++p;
+    if (before_end<_Padded>(p, pend) && is_integer(*p)) { // 0 cannot be followed by an integer
+      return result_type::Invalid;
     }
-    i = 0;
   } else {
-    if (!(is_integer(*p))) { // must start with an integer
-      pinit = p;
-      return false;
+    if (!is_integer(*p) && !(Policy::leading_point && Policy::separators::contains(*p))) {
+      return result_type::Invalid; // must start with an integer
     }
-    _Uchar digit = *p - '0';
-    i = digit;
-    p++;
-    // the is_made_of_eight_digits_fast routine is unlikely to help here because
-    // we rarely see large integer parts like 123456789
-    while (p < pend && is_integer(*p)) {
-      digit = *p - '0';
-	  ++p;
+    if (Policy::leading_zeros) {
+      // the zeros are not significant digits, and do not count below
+      while (before_end<_Padded>(p, pend) && *p == '0') {
+        ++p;
+      }
+      start_digits = p;
+    }
+    // eight digits at a time, then one at a time. There is no overflow
+    // check in these loops: i may wrap around, and the digit count below
+    // tells us whether it did.
+    while (parse_eight_digits<_Padded>(p, pend, i)) {
+      p += 8;
+    }
+    while (before_end<_Padded>(p, pend) && is_integer(*p)) {
+      _Uchar digit = *p - '0';
+      ++p;
       // a multiplication by 10 is cheaper than an arbitrary integer
       // multiplication
-      
-      //int64_t::max=2^63-1
-      //2 ^ 63 = 9223372036854775808
-      //2 ^ 62 = 922337203685477580 = 0x0CCCCCCCCCCCCCCC
-	  if (unlikely(i >= 922337203685477580))
-	  {
-		  if (i != 922337203685477580 || digit >= 8)
-		  {
-              is_overflow = true;
-              while (p < pend && is_integer(*p)) ++p;
-			  break;
-		  }
-	  }
-      i = 10 * i + digit; // might overflow, we will handle the overflow later
+      i = 10 * i + digit;
+    }
+    if (Policy::group_separator != 0 && before_end<_Padded>(p, pend) && is_group_separator<Policy>(*p)) {
+      // digit grouping: one to three digits, then groups of exactly three
+      if (p - start_integer > 3 || p == start_integer) {
+        return result_type::Invalid;
+      }
+      do {
+        if (!((_Padded || pend - p > 3) && is_integer(p[1]) && is_integer(p[2]) && is_integer(p[3]))) {
+          return result_type::Invalid;
+        }
+        i = 1000 * i + uint64_t(p[1] - '0') * 100 + uint64_t(p[2] - '0') * 10 + uint64_t(p[3] - '0');
+        p += 4;
+        groups++;
+      } while (before_end<_Padded>(p, pend) && is_group_separator<Policy>(*p));
+      if (before_end<_Padded>(p, pend) && is_integer(*p)) {
+        return result_type::Invalid;
+      }
     }
   }
+  const _Char *const end_integer = p;
+  const _Char *first_after_period = p;
 
-  int64_t exponent = 0;
-  const _Char *first_after_period = NULL;
-  if (is_one_of<_Char, DecSeparators...>(*p)) {
+  if (before_end<_Padded>(p, pend) && Policy::separators::contains(*p)) {
     is_double = true;
     ++p;
     first_after_period = p;
-    if (p < pend && is_integer(*p)) {
-      _Uchar digit = *p - '0';
-      ++p;
-      i = i * 10 + digit; // might overflow + multiplication by 10 is likely
-                          // cheaper than arbitrary mult.
-      // we will handle the overflow later
-    } else {
-      pinit = p;
-      return false;
+    if (!(before_end<_Padded>(p, pend) && is_integer(*p))) {
+      // "5." needs trailing_point, and "." is never a number
+      if (!Policy::trailing_point || end_integer == start_integer) {
+        return result_type::Invalid;
+      }
     }
-    while (p < pend && is_integer(*p)) {
+    while (parse_eight_digits<_Padded>(p, pend, i)) {
+      p += 8;
+    }
+    for (; before_end<_Padded>(p, pend) && is_integer(*p); ++p) {
       _Uchar digit = *p - '0';
-      ++p;
+      i = i * 10 + digit;
+    }
+    exponent -= p - first_after_period;
+  }
+
+  // One overflow check for all the digits. Up to 19 digits always fit.
+  // A 20-digit integer fits in a uint64_t if it starts with a 1 and i did
+  // not wrap around: values from 10^19 to 2 * 10^19 that went past 2^64
+  // wrap to less than 10^19.
+  int64_t digit_count = int64_t(end_integer - start_digits) - groups + int64_t(p - first_after_period);
+  if (unlikely(digit_count > 19) &&
+      !(digit_count == 20 && !is_double && *start_digits == '1' &&
+        i >= 10000000000000000000ULL)) {
+    // Start over with the first 19 significant digits (leading zeros, as
+    // in 0.000..., do not count).
+    const _Char *spans[2][2] = {{start_digits, end_integer}, {first_after_period, p}};
+    uint64_t w = 0;
+    int64_t kept = 0;
+    int64_t dropped = 0;
+    for (int t = 0; t < 2; t++) {
+      for (const _Char *d = spans[t][0]; d != spans[t][1]; ++d) {
+        if (is_group_separator<Policy>(*d)) {
+          continue;
+        }
+        if (kept == 19) {
+          dropped++;
+          truncated |= *d != '0';
+        } else if (kept != 0 || *d != '0') {
+          w = 10 * w + uint64_t(*d - '0');
+          kept++;
+        }
+      }
+    }
+    if (dropped != 0) {
+      i = w;
+      exponent += dropped;
+      is_overflow = true;
+    }
+  }
 
-	  //int64_t::max=2^63-1
-	  //2 ^ 63 = 9223372036854775808
-	  //2 ^ 62 = 922337203685477580 = 0x0CCCCCCCCCCCCCCC
-	  if (unlikely(i >= 922337203685477580))
-	  {
-		  if (i != 922337203685477580 || digit >= 8)
-		  {
-              is_overflow = true;
-			  while (p < pend && is_integer(*p)) ++p;
-			  break;
-		  }
-	  }
-      i = i * 10 + digit; // in rare cases, this will overflow, but that's ok
-                          // because we have parse_highprecision_float later.
-    }
-    exponent = first_after_period - p;
-  }
-
-  int digit_count = int(p - start_digits - 1); // used later to guard against overflows
   int64_t exp_number = 0;   // exponential part
-  if ((*p | 32) == 'e') {
+  if (before_end<_Padded>(p, pend) && is_exponent_char<Policy>(*p)) {
     is_double = true;
     ++p;
     bool neg_exp = false;
-    if ('-' == *p) {
+    if (before_end<_Padded>(p, pend) && '-' == *p) {
       neg_exp = true;
       ++p;
-    } else if ('+' == *p) {
+    } else if (before_end<_Padded>(p, pend) && '+' == *p) {
       ++p;
     }
-    if (p >= pend || !is_integer(*p)) {
-      pinit = p;
-      return false;
+    if (!before_end<_Padded>(p, pend) || !is_integer(*p)) {
+      return result_type::Invalid;
     }
     _Uchar digit = *p - '0';
     exp_number = digit;
     p++;
-    if (p < pend && is_integer(*p)) {
+    if (before_end<_Padded>(p, pend) && is_integer(*p)) {
       digit = *p - '0';
       exp_number = 10 * exp_number + digit;
       ++p;
     }
-    if (p < pend && is_integer(*p)) {
+    if (before_end<_Padded>(p, pend) && is_integer(*p)) {
       digit = *p - '0';
       exp_number = 10 * exp_number + digit;
       ++p;
     }
-    while (p < pend && is_integer(*p)) {
+    while (before_end<_Padded>(p, pend) && is_integer(*p)) {
       if (exp_number > 0x100000000) { // we need to check for overflows
                                       // we refuse to parse this
-        pinit = p;
-        return false;
+        return result_type::Invalid;
       }
       digit = *p - '0';
       exp_number = 10 * exp_number + digit;
@@ -1518,74 +2434,421 @@ bool parse_number_base(const _Char*&pinit, double *outDouble, const _Char* pend)
     exponent += (neg_exp ? -exp_number : exp_number);
   }
 
-  if (unlikely(is_overflow)) {
-	  return parse_float_strtod(pinit, outDouble, pend);
+  if (_Padded && p > pend) { // the only bounds check of padded mode
+    return result_type::Invalid;
   }
+  out.mantissa = i;
+  out.exponent = exponent;
+  out.negative = negative;
+  out.truncated = truncated;
+  // an integer too large for a uint64_t is a double
+  return (is_double || is_overflow) ? result_type::Double : result_type::Long;
+}
 
-  // If we frequently had to deal with long strings of digits,
-  // we could extend our code by using a 128-bit integer instead
-  // of a 64-bit integer. However, this is uncommon.
-  if (is_double && unlikely(digit_count >= 19)) { // this is uncommon
-    // It is possible that the integer had an overflow.
-    // We have to handle the case where we have 0.0000somenumber.
-    const _Char *start = start_digits;
-    while (*start == '0' || is_one_of<_Char, DecSeparators...>(*start)) {
-      start++;
-    }
-
-    // we over-decrement by one when there is a decimal separator
-    digit_count -= int(start - start_digits);
-    if (digit_count >= 19) {
-      // Chances are good that we had an overflow!
-      // We start anew.
-      // This will happen in the following examples:
-      // 10000000000000000000000000000000000000000000e+308
-      // 3.1415926535897932384626433832795028841971693993751
-      //
-      return parse_float_strtod(pinit, outDouble, pend);
-    }
+// parse the number at p
+// T is double or float: a float result is rounded once, directly from the
+// decimal input. Integers go to *outLong when it is not null, and are
+// converted to T otherwise.
+template <class T, bool _Padded, class Policy, class _Char>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 result_type parse_number_core(const _Char*&pinit, T *outDouble, int64_t *outLong, const _Char* pend) {
+  const _Char *p = pinit;
+  decimal_components c;
+  result_type scanned = scan_number<_Padded, Policy>(p, c, pend);
+  if (scanned == result_type::Invalid) {
+    pinit = p;
+    return result_type::Invalid;
   }
-  assert(!is_overflow);
+  const bool negative = c.negative;
+  const uint64_t i = c.mantissa;
+  const int64_t exponent = c.exponent;
 
-  if (is_double)
+  if (scanned == result_type::Double)
   {
-    if (unlikely(exponent < FASTFLOAT_SMALLEST_POWER) || (exponent > FASTFLOAT_LARGEST_POWER)) {
+    prefetch_power_of_ten(exponent);
+    if (unlikely(i == 0 || exponent < binary_format<T>::smallest_power_of_ten())) {
+      // Only zeros (as in 0e999), or so small that even (i + 1) * 10^exponent
+      // is below half of the smallest subnormal: a signed zero.
+      *outDouble = negative ? -T(0) : T(0);
+      pinit = p;
+      return result_type::Double;
+    }
+    if (unlikely(exponent > binary_format<T>::largest_power_of_ten())) {
       // this is almost never going to get called!!!
-      // exponent could be as low as 325
-      return parse_float_strtod(pinit, outDouble, pend);
+      return parse_float_fallback<T, Policy>(pinit, outDouble, p) ? result_type::Double : result_type::Invalid;
     }
     // from this point forward, exponent >= FASTFLOAT_SMALLEST_POWER and
-    // exponent <= FASTFLOAT_LARGEST_POWER
+    // exponent <= FASTFLOAT_LARGEST_POWER (the _32 bounds for floats)
     bool success = true;
-    *outDouble = compute_float_64(exponent, i, negative, &success);
+    *outDouble = binary_format<T>::compute_float(exponent, i, negative, &success);
+    if (unlikely(c.truncated) && success) {
+      // We dropped non-zero digits, so the value lies strictly between
+      // i * 10^exponent and (i + 1) * 10^exponent. If both ends round to
+      // the same double, so does the value; i + 1 cannot overflow since i
+      // has only 19 digits.
+      bool success_up = true;
+      T up = binary_format<T>::compute_float(exponent, i + 1, negative, &success_up);
+      success = success_up && up == *outDouble;
+    }
     if (!success) {
       // we are almost never going to get here.
-      return parse_float_strtod(pinit, outDouble, pend);
+      return parse_float_fallback<T, Policy>(pinit, outDouble, p) ? result_type::Double : result_type::Invalid;
     }
     pinit = p;
-    return true;
+    return result_type::Double;
   }
   else
   {
-    *outDouble = (double)(negative ? -(int64_t)i : (int64_t)i);
-	pinit = p;
-    return true;
+    pinit = p;
+    if (outLong) {
+      if (!negative) {
+        *outLong = int64_t(i);
+        return i <= uint64_t(INT64_MAX) ? result_type::Long : result_type::ULong;
+      }
+      if (i <= uint64_t(1) << 63) {
+        *outLong = int64_t(0 - i); // -2^63 included
+        return result_type::Long;
+      }
+      // below INT64_MIN: a double
+    }
+    // a single rounding from the exact integer
+    *outDouble = negative ? -T(i) : T(i);
+    return result_type::Double;
   }
 }
 
+template <class _Char, _Char... DecSeparators, class T>
+WARN_UNUSED
+FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_number_base(const _Char*&pinit, T *outDouble, const _Char* pend) {
+  return parse_number_core<T, false, separator_policy<_Char, DecSeparators...>>(pinit, outDouble, nullptr, pend) != result_type::Invalid;
+}
+
+// Stops after scanning: *out is the number as mantissa * 10^exponent,
+// with no binary conversion at all.
+template <class _Char, _Char... DecSeparators>
+WARN_UNUSED
+FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_number_base(const _Char*&pinit, decimal_components *out, const _Char* pend) {
+  return scan_number<false, separator_policy<_Char, DecSeparators...>>(pinit, *out, pend) != result_type::Invalid;
+}
+
+// Same as parse_number_base, for input that is padded: there must be
+// FAST_DOUBLE_PARSER_PADDING readable characters past pend, and the number
+// must end at or before pend, on a character that cannot continue it
+// (*pend itself is typically a space, a comma, a bracket or a NUL). The
+// scanner then drops its per-character bounds checks; a number that runs
+// past pend is only caught at the end, and refused.
+template <class _Char, _Char... DecSeparators, class T>
+WARN_UNUSED
+FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_number_padded_base(const _Char*&pinit, T *outDouble, const _Char* pend) {
+  return parse_number_core<T, true, separator_policy<_Char, DecSeparators...>>(pinit, outDouble, nullptr, pend) != result_type::Invalid;
+}
+
+template <class _Char, _Char... DecSeparators>
+WARN_UNUSED
+FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_number_padded_base(const _Char*&pinit, decimal_components *out, const _Char* pend) {
+  return scan_number<true, separator_policy<_Char, DecSeparators...>>(pinit, *out, pend) != result_type::Invalid;
+}
+
+// A double, an int64_t or a uint64_t: see parse_value_base.
+union number_value {
+  int64_t l;
+  uint64_t ul;
+  double d;
+};
+
+// Same syntax as parse_number_base, but integers that fit in an int64_t
+// are not converted: they come back exactly in out->l, with
+// result_type::Long. Unsigned integers from 2^63 to 2^64 - 1 are
+// result_type::ULong, in out->ul. Everything else is result_type::Double
+// in out->d, or result_type::Invalid when parse_number_base would return
+// false.
+template <class _Char, _Char... DecSeparators>
+WARN_UNUSED
+FAST_DOUBLE_PARSER_CONSTEXPR20 result_type parse_value_base(const _Char*&pinit, number_value *out, const _Char* pend) {
+  return parse_number_core<double, false, separator_policy<_Char, DecSeparators...>>(pinit, &out->d, &out->l, pend);
+}
+
+// The same parsers, with the grammar given by a policy (json_policy,
+// strtod_policy, csv_policy or your own) rather than by a list of
+// separators: parse_number_policy<json_policy>(p, &d, pend).
+template <class Policy, class _Char, class T>
+WARN_UNUSED
+FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_number_policy(const _Char*&pinit, T *outDouble, const _Char* pend) {
+  return parse_number_core<T, false, Policy>(pinit, outDouble, nullptr, pend) != result_type::Invalid;
+}
+
+template <class Policy, class _Char>
+WARN_UNUSED
+FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_number_policy(const _Char*&pinit, decimal_components *out, const _Char* pend) {
+  return scan_number<false, Policy>(pinit, *out, pend) != result_type::Invalid;
+}
+
+template <class Policy, class _Char>
+WARN_UNUSED
+FAST_DOUBLE_PARSER_CONSTEXPR20 result_type parse_value_policy(const _Char*&pinit, number_value *out, const _Char* pend) {
+  return parse_number_core<double, false, Policy>(pinit, &out->d, &out->l, pend);
+}
+
+#ifdef __SIZEOF_INT128__
+// Integers of up to 39 digits, for the ID and hash columns that do not fit
+// in 64 bits. T is __int128 or unsigned __int128. The syntax is the integer
+// part of parse_number_base: an optional sign, then digits with no leading
+// zero. Parsing stops at the first character that is not a digit. Returns
+// false if the value does not fit in T (for unsigned __int128, a negative
+// value other than -0).
+template <class _Char, class T>
+WARN_UNUSED
+FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_int128_base(const _Char *&pinit, T *out, const _Char *pend) {
+  typedef unsigned __int128 u128;
+  const _Char *p = pinit;
+  bool negative = false;
+  if (p >= pend || !parse_sign(p, pend, negative) || !is_integer(*p)) {
+    pinit = p;
+    return false;
+  }
+  const _Char *const start_digits = p;
+  u128 i = 0;
+  if (*p == '0') { // 0 cannot be followed by an integer
+    ++p;
+    if (p < pend && is_integer(*p)) {
+      pinit = p;
+      return false;
+    }
+  } else {
+    // no overflow check in these loops, as in parse_number_base
+    uint64_t block = 0;
+    while (parse_eight_digits(p, pend, block)) {
+      i = i * 100000000 + block;
+      block = 0;
+      p += 8;
+    }
+    for (; p < pend && is_integer(*p); ++p) {
+      i = i * 10 + uint64_t(*p - '0');
+    }
+  }
+  // One overflow check for all the digits. Up to 38 digits always fit. 39
+  // digits fit if the first one is at most 3 and i did not wrap around:
+  // values from 10^38 to 4 * 10^38 that went past 2^128 wrap to less than
+  // 10^38.
+  const u128 e38 = u128(10000000000000000000ULL) * 10000000000000000000ULL;
+  int64_t digit_count = int64_t(p - start_digits);
+  pinit = p;
+  if (digit_count > 39 ||
+      (digit_count == 39 && (*start_digits > '3' || i < e38))) {
+    return false;
+  }
+  const bool is_signed = T(-1) < T(0);
+  if (is_signed) {
+    // 2^127 - 1, or 2^127 for a negative number
+    if (i > (u128(1) << 127) - 1 + u128(negative)) {
+      return false;
+    }
+  } else if (negative && i != 0) {
+    return false;
+  }
+  *out = negative ? T(0 - i) : T(i);
+  return true;
+}
+#endif
+
+// Hexadecimal floating-point numbers, as printed by %a:
+// 0x1.91eb851eb851fp+1 is 0x191eb851eb851f * 2^(1 - 52). The value is a
+// binary mantissa times a power of two, so it converts exactly, without
+// a table of powers and without a slow path: only the final rounding to
+// 53 (or 24) bits is left.
+
+// m * 2^exponent, rounded to nearest even. truncated means that non-zero
+// digits were dropped after m, so that the value is slightly above.
+template <class T>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 T compute_float_hex(int64_t exponent, uint64_t m, bool negative, bool truncated) {
+  if (m == 0) {
+    return negative ? -T(0) : T(0);
+  }
+  int lz = leading_zeroes(m);
+  // the exponent for round_extended, as compute_error sets it up
+  int64_t power2 = exponent - lz + binary_format<T>::mantissa_explicit_bits() +
+                   binary_format<T>::exponent_bias();
+  if (power2 < -63) {
+    // below half of the smallest subnormal, even when rounded up
+    return negative ? -T(0) : T(0);
+  }
+  if (power2 > binary_format<T>::infinite_power()) {
+    power2 = binary_format<T>::infinite_power(); // round_extended makes it infinite
+  }
+  adjusted_mantissa am;
+  am.mantissa = m << lz;
+  am.power2 = int32_t(power2);
+  round_nearest_rule rule;
+  rule.truncated = truncated;
+  round_extended<T>(am, rule);
+  return to_binary<T>(negative, am);
+}
+
+// Appends the hex digits at p to m, which keeps at most 16 of them (kept
+// counts them). Digits past those are dropped and counted in dropped;
+// truncated records whether any of them was not a zero.
+template <class _Char>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 void parse_hex_digits(const _Char *&p, const _Char *pend, uint64_t &m, int &kept,
+                                    int64_t &dropped, bool &truncated) {
+  for (;;) {
+    if (kept <= 8 && parse_eight_hex_digits(p, pend, m)) {
+      p += 8;
+      kept += 8;
+      continue;
+    }
+    if (p >= pend) {
+      return;
+    }
+    uint32_t digit = hex_digit_value(*p);
+    if (digit > 15) {
+      return;
+    }
+    ++p;
+    if (kept < 16) {
+      m = (m << 4) | digit;
+      kept++;
+    } else {
+      dropped++;
+      truncated |= digit != 0;
+    }
+  }
+}
+
+// An optional sign, 0x or 0X, hex digits with an optional separator
+// (there must be at least one digit), then an optional binary exponent:
+// p or P, an optional sign and decimal digits.
+template <class T, class _Char, _Char... DecSeparators>
+really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_hex_core(const _Char *&pinit, T *outDouble, const _Char *pend) {
+  const _Char *p = pinit;
+  bool negative = false;
+  if (p >= pend || !parse_sign(p, pend, negative) || pend - p < 2 ||
+      p[0] != '0' || (p[1] | 32) != 'x') {
+    pinit = p;
+    return false;
+  }
+  p += 2;
+  uint64_t m = 0;
+  int kept = 0;
+  int64_t dropped = 0;
+  bool truncated = false;
+  int64_t exponent = 0; // binary
+
+  const _Char *const start_digits = p;
+  while (p < pend && *p == '0') { // leading zeros are not significant
+    ++p;
+  }
+  parse_hex_digits(p, pend, m, kept, dropped, truncated);
+  exponent += 4 * dropped;
+  bool any_digit = p != start_digits;
+
+  if (p < pend && is_one_of<_Char, DecSeparators...>(*p)) {
+    ++p;
+    const _Char *const first_after_period = p;
+    if (kept == 0) {
+      while (p < pend && *p == '0') {
+        ++p;
+      }
+    }
+    dropped = 0;
+    parse_hex_digits(p, pend, m, kept, dropped, truncated);
+    exponent -= 4 * (int64_t(p - first_after_period) - dropped);
+    any_digit |= p != first_after_period;
+  }
+  if (!any_digit) {
+    pinit = p;
+    return false;
+  }
+
+  if (p < pend && (*p | 32) == 'p') {
+    ++p;
+    bool neg_exp = false;
+    if (p < pend && (*p == '-' || *p == '+')) {
+      neg_exp = *p == '-';
+      ++p;
+    }
+    if (p >= pend || !is_integer(*p)) {
+      pinit = p;
+      return false;
+    }
+    int64_t exp_number = 0;
+    for (; p < pend && is_integer(*p); ++p) {
+      if (exp_number > 0x100000000) { // as in parse_number_base, we refuse to parse this
+        pinit = p;
+        return false;
+      }
+      exp_number = 10 * exp_number + (*p - '0');
+    }
+    exponent += neg_exp ? -exp_number : exp_number;
+  }
+
+  T d = compute_float_hex<T>(exponent, m, negative, truncated);
+  if (is_infinite(d)) { // refused, as parse_number_base refuses overflow
+    return false;
+  }
+  *outDouble = d;
+  pinit = p;
+  return true;
+}
+
+// Parses a hexadecimal floating-point number (see parse_hex_core) into a
+// double or a float. The result is always correctly rounded; a value that
+// rounds to infinity is refused, as in parse_number_base.
+template <class _Char, _Char... DecSeparators, class T>
+WARN_UNUSED
+FAST_DOUBLE_PARSER_CONSTEXPR20 bool parse_hex_base(const _Char *&pinit, T *outDouble, const _Char *pend) {
+  return parse_hex_core<T, _Char, DecSeparators...>(pinit, outDouble, pend);
+}
+
 typedef bool (*parser_function_t)(const char *&p, double *outDouble, const char *pend);
+typedef bool (*parser_function_32_t)(const char *&p, float *outFloat, const char *pend);
+typedef result_type (*value_parser_function_t)(const char *&p, number_value *out, const char *pend);
 
+// Stateless function object calling Fn. The entry points below are
+// objects of this type rather than function pointers: a call through them
+// is a direct call to Fn, which the compiler can inline into the caller's
+// loop, and the result is checked (WARN_UNUSED does nothing on a
+// variable). They still convert to the pointer types above.
+template <class R, class T, R (*Fn)(const char *&, T *, const char *)>
+struct parser_entry {
+  typedef R (*function_type)(const char *&p, T *out, const char *pend);
+
+  WARN_UNUSED really_inline FAST_DOUBLE_PARSER_CONSTEXPR20 R operator()(const char *&p, T *out, const char *pend) const {
+    return Fn(p, out, pend);
+  }
+
+  constexpr operator function_type() const { return Fn; }
+};
+
+template <char... DecSeparators>
+struct parser_entries {
+  typedef parser_entry<bool, double, parse_number_base<char, DecSeparators...>> number;
+  typedef parser_entry<bool, float, parse_number_base<char, DecSeparators...>> number_32;
+  typedef parser_entry<result_type, number_value, parse_value_base<char, DecSeparators...>> value;
+  typedef parser_entry<bool, double, parse_hex_base<char, DecSeparators...>> hex;
+  typedef parser_entry<bool, double, parse_number_padded_base<char, DecSeparators...>> number_padded;
+};
 
-constexpr parser_function_t parse_number WARN_UNUSED = parse_number_base<char, '.', ','>;
+constexpr parser_entries<'.', ','>::number parse_number{};
+constexpr parser_entries<'.', ','>::number_32 parse_float{};
+constexpr parser_entries<'.', ','>::value parse_value{};
+constexpr parser_entries<'.', ','>::hex parse_hex{};
+constexpr parser_entries<'.', ','>::number_padded parse_number_padded{};
 
 namespace decimal_separator_dot
 {
-  constexpr parser_function_t parse_number WARN_UNUSED = parse_number_base<char, '.'>;
+  constexpr parser_entries<'.'>::number parse_number{};
+  constexpr parser_entries<'.'>::number_32 parse_float{};
+  constexpr parser_entries<'.'>::value parse_value{};
+  constexpr parser_entries<'.'>::hex parse_hex{};
+  constexpr parser_entries<'.'>::number_padded parse_number_padded{};
 }
 
 namespace decimal_separator_comma
 {
-  constexpr parser_function_t parse_number WARN_UNUSED = parse_number_base<char, ','>;
+  constexpr parser_entries<','>::number parse_number{};
+  constexpr parser_entries<','>::number_32 parse_float{};
+  constexpr parser_entries<','>::value parse_value{};
+  constexpr parser_entries<','>::hex parse_hex{};
+  constexpr parser_entries<','>::number_padded parse_number_padded{};
 }
 
 } // namespace fast_double_parser
@@ -1,8 +1,56 @@
 #pragma once
+#include <cassert>
+#include <cmath>
+#include <cstdint>
 #include <limits>
 #include <tuple>
 
-#include <emmintrin.h>		//SSE2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+#include "fast_double_parser.h"
+
+// Every kernel set is compiled with its own target options and selected at
+// run time, so the header can be built for baseline x86-64 and still use
+// AVX2 when the CPU has it. The lowest set that gets compiled follows the
+// compiler flags: with -mavx2 only the AVX2 kernels are built and there is
+// no dispatch at all. Define SIMD_DOUBLE_PARSER_NO_DISPATCH to use only the
+// kernels allowed by the compiler flags.
+#define SIMD_DOUBLE_PARSER_ISA_SSE2 0
+#define SIMD_DOUBLE_PARSER_ISA_SSSE3 1
+#define SIMD_DOUBLE_PARSER_ISA_SSE41 2
+#define SIMD_DOUBLE_PARSER_ISA_AVX2 3
+
+#if defined(__AVX2__)
+#define SIMD_DOUBLE_PARSER_MIN_ISA SIMD_DOUBLE_PARSER_ISA_AVX2
+#elif defined(__SSE4_1__)
+#define SIMD_DOUBLE_PARSER_MIN_ISA SIMD_DOUBLE_PARSER_ISA_SSE41
+#elif defined(__SSSE3__)
+#define SIMD_DOUBLE_PARSER_MIN_ISA SIMD_DOUBLE_PARSER_ISA_SSSE3
+#else
+#define SIMD_DOUBLE_PARSER_MIN_ISA SIMD_DOUBLE_PARSER_ISA_SSE2
+#endif
+
+#ifdef SIMD_DOUBLE_PARSER_NO_DISPATCH
+#define SIMD_DOUBLE_PARSER_MAX_ISA SIMD_DOUBLE_PARSER_MIN_ISA
+#else
+#define SIMD_DOUBLE_PARSER_MAX_ISA SIMD_DOUBLE_PARSER_ISA_AVX2
+#endif
+
+// A load that runs past the end of the input but stays inside the page is
+// harmless, yet AddressSanitizer reports it, so under ASan short tails always
+// go through the bounded paths.
+#if defined(__SANITIZE_ADDRESS__)
+#define SIMD_DOUBLE_PARSER_ASAN
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define SIMD_DOUBLE_PARSER_ASAN
+#endif
+#endif
 
 namespace simd_double_parser
 {
@@ -31,7 +79,9 @@ namespace simd_double_parser
 	union number_value
 	{
 		int64_t l;
+		uint64_t ul;
 		double d;
+		float f;
 	};
 
 	enum struct parser_result
@@ -39,16 +89,430 @@ namespace simd_double_parser
 		Invalid,
 		Long,
 		Double,
+		Float,
+		ULong,	// an integer in [2^63, 2^64), in number_value::ul
+	};
+
+	// What simd_double_parser2 produces for numbers that are not integers.
+	enum x_parse_mode
+	{
+		x_mode_fast,	// double, scaled by a plain multiplication
+		x_mode_exact,	// double, correctly rounded
+		x_mode_float,	// float, correctly rounded
+		x_mode_decimal,	// no conversion: decimal_components, for integers too
+	};
+
+	typedef fast_double_parser::decimal_components decimal_components;
+
+	// The grammar of parser(), parser_exact() and the others: a leading +,
+	// ".5" and "5." are numbers, a leading 0 cannot be followed by a digit,
+	// and the separator is '.'. parser_policy() takes any
+	// fast_double_parser policy (json_policy, strtod_policy, ...) instead.
+	struct default_policy : fast_double_parser::strtod_policy
+	{
+		static constexpr bool leading_zeros = false;
+	};
+
+	// What simd_double_parser2 returns in each mode.
+	template<x_parse_mode _Mode>
+	struct x_mode_result
+	{
+		typedef std::tuple<number_value, parser_result> type;
+	};
+
+	template<>
+	struct x_mode_result<x_mode_decimal>
+	{
+		typedef std::tuple<decimal_components, parser_result> type;
+	};
+
+	enum struct cpu_level
+	{
+		SSE2 = SIMD_DOUBLE_PARSER_ISA_SSE2,
+		SSSE3 = SIMD_DOUBLE_PARSER_ISA_SSSE3,
+		SSE41 = SIMD_DOUBLE_PARSER_ISA_SSE41,
+		AVX2 = SIMD_DOUBLE_PARSER_ISA_AVX2,
+	};
+
+	inline void x_cpuid(uint32_t info[4], uint32_t leaf, uint32_t subleaf) noexcept
+	{
+#ifdef _MSC_VER
+		__cpuidex((int*)info, (int)leaf, (int)subleaf);
+#else
+		__cpuid_count(leaf, subleaf, info[0], info[1], info[2], info[3]);
+#endif
+	}
+
+	inline uint64_t x_xgetbv0() noexcept
+	{
+#ifdef _MSC_VER
+		return _xgetbv(0);
+#else
+		uint32_t eax, edx;
+		__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		return ((uint64_t)edx << 32) | eax;
+#endif
+	}
+
+	inline cpu_level x_detect_cpu_level() noexcept
+	{
+		uint32_t info[4];
+		x_cpuid(info, 0, 0);
+		uint32_t max_leaf = info[0];
+
+		x_cpuid(info, 1, 0);
+		bool ssse3 = (info[2] & (1u << 9)) != 0;
+		bool sse41 = (info[2] & (1u << 19)) != 0;
+		bool osxsave = (info[2] & (1u << 27)) != 0;
+		bool avx = (info[2] & (1u << 28)) != 0;
+
+		bool avx2 = false, bmi1 = false;
+		if (max_leaf >= 7)
+		{
+			x_cpuid(info, 7, 0);
+			bmi1 = (info[1] & (1u << 3)) != 0;
+			avx2 = (info[1] & (1u << 5)) != 0;
+		}
+		// the OS must also save the YMM registers on context switches
+		bool ymm = osxsave && avx && (x_xgetbv0() & 6) == 6;
+
+		if (avx2 && bmi1 && ymm && sse41 && ssse3)
+			return cpu_level::AVX2;
+		if (sse41 && ssse3)
+			return cpu_level::SSE41;
+		if (ssse3)
+			return cpu_level::SSSE3;
+		return cpu_level::SSE2;
+	}
+
+	// Resolved once during static initialization. A parse that runs before
+	// that (from another static initializer) sees the zero value, SSE2.
+	template<class _Ty = void>
+	struct x_cpu_dispatch
+	{
+		static const cpu_level level;
+	};
+	template<class _Ty>
+	const cpu_level x_cpu_dispatch<_Ty>::level = x_detect_cpu_level();
+
+	inline cpu_level detected_cpu_level() noexcept
+	{
+		return x_cpu_dispatch<>::level;
+	}
+
+	// 10^n as double and uint64_t: the tables of fast_double_parser, one copy
+	// per program (see fast_double_parser::power_tables)
+#ifndef FAST_DOUBLE_PARSER_COMPACT_TABLES
+	static constexpr const auto& DOUBLE_E = fast_double_parser::power_of_ten;
+	static constexpr const auto& DOUBLE_NE = fast_double_parser::negative_power_of_ten;
+#endif
+	static constexpr const auto& LONG_E = fast_double_parser::powers_of_ten_uint64;
+
+	// The limits for x_mm_convert_string_long, shared the same way
+	template<class _Ty = void>
+	struct x_limit_tables
+	{
+		// LIMIT_LONG_E[n]: largest r with r * 10^n + (10^n - 1) <= INT64_MAX
+		static constexpr fast_double_parser::constexpr_array<uint64_t, 17> LIMIT_LONG_E =
+		{{
+			9223372036854775807,
+			922337203685477579,
+			92233720368547757,
+			9223372036854774,
+			922337203685476,
+			92233720368546,
+			9223372036853,
+			922337203684,
+			92233720367,
+			9223372035,
+			922337202,
+			92233719,
+			9223371,
+			922336,
+			92232,
+			9222,
+			921,
+		}};
+
+		// LIMIT_ULONG_E[n]: largest r with r * 10^n + (10^n - 1) <= UINT64_MAX
+		static constexpr fast_double_parser::constexpr_array<uint64_t, 17> LIMIT_ULONG_E =
+		{{
+			18446744073709551615u,
+			1844674407370955160,
+			184467440737095515,
+			18446744073709550,
+			1844674407370954,
+			184467440737094,
+			18446744073708,
+			1844674407369,
+			184467440736,
+			18446744072,
+			1844674406,
+			184467439,
+			18446743,
+			1844673,
+			184466,
+			18445,
+			1843,
+		}};
+	};
+#if __cplusplus < 201703L
+	template<class _Ty>
+	constexpr fast_double_parser::constexpr_array<uint64_t, 17> x_limit_tables<_Ty>::LIMIT_LONG_E;
+	template<class _Ty>
+	constexpr fast_double_parser::constexpr_array<uint64_t, 17> x_limit_tables<_Ty>::LIMIT_ULONG_E;
+#endif
+
+	// Upper bounds for x_mm_convert_string_long: the integer part of a
+	// number may use the whole uint64_t range, the fraction and the
+	// exponent stay within int64_t.
+	struct x_int64_limit
+	{
+		static constexpr uint64_t MAX = (uint64_t)(std::numeric_limits<int64_t>::max)();
+		static really_inline uint64_t limit_e(uint32_t n) noexcept { return x_limit_tables<>::LIMIT_LONG_E[n]; }
+	};
+
+	struct x_uint64_limit
+	{
+		static constexpr uint64_t MAX = (std::numeric_limits<uint64_t>::max)();
+		static really_inline uint64_t limit_e(uint32_t n) noexcept { return x_limit_tables<>::LIMIT_ULONG_E[n]; }
 	};
 
+#if SIMD_DOUBLE_PARSER_MIN_ISA <= SIMD_DOUBLE_PARSER_ISA_SSE2
+	namespace x_sse2
+	{
+#define SIMD_DOUBLE_PARSER_ISA SIMD_DOUBLE_PARSER_ISA_SSE2
+#include "simd_double_parser.inl"
+#undef SIMD_DOUBLE_PARSER_ISA
+	}
+#endif
+#if SIMD_DOUBLE_PARSER_MIN_ISA <= SIMD_DOUBLE_PARSER_ISA_SSSE3 && SIMD_DOUBLE_PARSER_MAX_ISA >= SIMD_DOUBLE_PARSER_ISA_SSSE3
+	namespace x_ssse3
+	{
+#define SIMD_DOUBLE_PARSER_ISA SIMD_DOUBLE_PARSER_ISA_SSSE3
+#include "simd_double_parser.inl"
+#undef SIMD_DOUBLE_PARSER_ISA
+	}
+#endif
+#if SIMD_DOUBLE_PARSER_MIN_ISA <= SIMD_DOUBLE_PARSER_ISA_SSE41 && SIMD_DOUBLE_PARSER_MAX_ISA >= SIMD_DOUBLE_PARSER_ISA_SSE41
+	namespace x_sse41
+	{
+#define SIMD_DOUBLE_PARSER_ISA SIMD_DOUBLE_PARSER_ISA_SSE41
+#include "simd_double_parser.inl"
+#undef SIMD_DOUBLE_PARSER_ISA
+	}
+#endif
+#if SIMD_DOUBLE_PARSER_MAX_ISA >= SIMD_DOUBLE_PARSER_ISA_AVX2
+	namespace x_avx2
+	{
+#define SIMD_DOUBLE_PARSER_ISA SIMD_DOUBLE_PARSER_ISA_AVX2
 #include "simd_double_parser.inl"
+#undef SIMD_DOUBLE_PARSER_ISA
+	}
+#endif
+
+#if SIMD_DOUBLE_PARSER_MIN_ISA == SIMD_DOUBLE_PARSER_ISA_AVX2
+	namespace x_baseline = x_avx2;
+#elif SIMD_DOUBLE_PARSER_MIN_ISA == SIMD_DOUBLE_PARSER_ISA_SSE41
+	namespace x_baseline = x_sse41;
+#elif SIMD_DOUBLE_PARSER_MIN_ISA == SIMD_DOUBLE_PARSER_ISA_SSSE3
+	namespace x_baseline = x_ssse3;
+#else
+	namespace x_baseline = x_sse2;
+#endif
+
+	template<size_t _CharSize>
+	struct x_char_type;
+	template<>
+	struct x_char_type<1> { using type = char; };
+	template<>
+	struct x_char_type<2> { using type = char16_t; };
+	template<>
+	struct x_char_type<4> { using type = char32_t; };
+
+	// _Hex selects simd_hex_parser2 (hexadecimal floating-point syntax),
+	// _Padded the padded-input contract of parser_padded.
+	template<x_parse_mode _Mode, bool _Hex, bool _Padded = false, class _Policy = default_policy, class _CharType>
+	really_inline
+	typename x_mode_result<_Mode>::type x_parser(const _CharType*& psz, const _CharType* const pszEnd, cpu_level level) noexcept
+	{
+		typedef typename x_char_type<sizeof(_CharType)>::type rechar_type;
+		// A copy rather than a reference cast: writing psz through a
+		// const rechar_type*& (wchar_t vs char32_t) breaks strict aliasing.
+		const rechar_type* s = (const rechar_type*)psz;
+		const rechar_type* e = (const rechar_type*)pszEnd;
+		(void)level;
+		typename x_mode_result<_Mode>::type result;
+
+#if SIMD_DOUBLE_PARSER_MIN_ISA == SIMD_DOUBLE_PARSER_MAX_ISA
+		result = x_baseline::x_kernel<_Mode, _Hex, _Padded, _Policy>::parse(s, e);
+#else
+		switch (level)
+		{
+		case cpu_level::AVX2:
+			result = x_avx2::x_kernel<_Mode, _Hex, _Padded, _Policy>::parse(s, e);
+			break;
+#if SIMD_DOUBLE_PARSER_MIN_ISA < SIMD_DOUBLE_PARSER_ISA_SSE41
+		case cpu_level::SSE41:
+			result = x_sse41::x_kernel<_Mode, _Hex, _Padded, _Policy>::parse(s, e);
+			break;
+#endif
+#if SIMD_DOUBLE_PARSER_MIN_ISA < SIMD_DOUBLE_PARSER_ISA_SSSE3
+		case cpu_level::SSSE3:
+			result = x_ssse3::x_kernel<_Mode, _Hex, _Padded, _Policy>::parse(s, e);
+			break;
+#endif
+		default:
+			result = x_baseline::x_kernel<_Mode, _Hex, _Padded, _Policy>::parse(s, e);
+			break;
+		}
+#endif
+		psz = (const _CharType*)s;
+		return result;
+	}
+
+	// Parses with the kernels of the given level. The level must not be
+	// higher than what the CPU supports; levels that were not compiled in
+	// use the lowest compiled kernel set.
+	// Doubles may be a few ulps off: the significand is scaled with a plain
+	// multiplication by a power of ten. Integers are parser_result::Long,
+	// or parser_result::ULong for unsigned ones in [2^63, 2^64).
+	template<class _CharType>
+	really_inline
+	std::tuple<number_value, parser_result> parser(const _CharType*& psz, const _CharType* const pszEnd, cpu_level level) noexcept
+	{
+		return x_parser<x_mode_fast, false>(psz, pszEnd, level);
+	}
 
 	template<class _CharType>
 	really_inline
 	std::tuple<number_value, parser_result> parser(const _CharType*& psz, const _CharType* const pszEnd) noexcept
 	{
-		typedef x_convert_char_selector<sizeof(_CharType)> char_selector;
-		typedef typename char_selector::type rechar_type;
-		return simd_double_parser2((const rechar_type*&)psz, (const rechar_type*)pszEnd);
+		return parser(psz, pszEnd, x_cpu_dispatch<>::level);
+	}
+
+	// Same syntax as parser(), but doubles are correctly rounded and match
+	// strtod bit for bit. Most inputs take the same SIMD front end plus
+	// fast_double_parser::compute_float_64; the rest go through
+	// fast_double_parser::parse_float_slow.
+	template<class _CharType>
+	really_inline
+	std::tuple<number_value, parser_result> parser_exact(const _CharType*& psz, const _CharType* const pszEnd, cpu_level level) noexcept
+	{
+		return x_parser<x_mode_exact, false>(psz, pszEnd, level);
+	}
+
+	template<class _CharType>
+	really_inline
+	std::tuple<number_value, parser_result> parser_exact(const _CharType*& psz, const _CharType* const pszEnd) noexcept
+	{
+		return parser_exact(psz, pszEnd, x_cpu_dispatch<>::level);
+	}
+
+	// Same syntax as parser(), but non-integers come back as correctly
+	// rounded floats (parser_result::Float, in number_value::f), matching
+	// strtof bit for bit. Integers are still parser_result::Long.
+	template<class _CharType>
+	really_inline
+	std::tuple<number_value, parser_result> parser_float(const _CharType*& psz, const _CharType* const pszEnd, cpu_level level) noexcept
+	{
+		return x_parser<x_mode_float, false>(psz, pszEnd, level);
+	}
+
+	template<class _CharType>
+	really_inline
+	std::tuple<number_value, parser_result> parser_float(const _CharType*& psz, const _CharType* const pszEnd) noexcept
+	{
+		return parser_float(psz, pszEnd, x_cpu_dispatch<>::level);
+	}
+
+	// Same syntax as parser(), but stops after scanning: the number comes
+	// back as decimal_components (mantissa * 10^exponent, the sign and
+	// whether non-zero digits past the 19th were dropped), with no binary
+	// conversion. parser_result::Long means that the input was an integer
+	// (the exponent is 0), parser_result::Double anything else.
+	template<class _CharType>
+	really_inline
+	std::tuple<decimal_components, parser_result> parser_decimal(const _CharType*& psz, const _CharType* const pszEnd, cpu_level level) noexcept
+	{
+		return x_parser<x_mode_decimal, false>(psz, pszEnd, level);
+	}
+
+	template<class _CharType>
+	really_inline
+	std::tuple<decimal_components, parser_result> parser_decimal(const _CharType*& psz, const _CharType* const pszEnd) noexcept
+	{
+		return parser_decimal(psz, pszEnd, x_cpu_dispatch<>::level);
+	}
+
+	// For padded input, as fast_double_parser::parse_number_padded_base:
+	// FAST_DOUBLE_PARSER_PADDING readable characters past pszEnd, and the
+	// number ends at or before pszEnd on a character that cannot continue
+	// it. The scan then checks the bounds once, at the end. _Mode picks the
+	// result as in parser() (x_mode_fast), parser_exact() (x_mode_exact),
+	// parser_float() (x_mode_float) or parser_decimal() (x_mode_decimal).
+	template<x_parse_mode _Mode, class _CharType>
+	really_inline
+	typename x_mode_result<_Mode>::type parser_padded(const _CharType*& psz, const _CharType* const pszEnd, cpu_level level) noexcept
+	{
+		return x_parser<_Mode, false, true>(psz, pszEnd, level);
+	}
+
+	template<x_parse_mode _Mode, class _CharType>
+	really_inline
+	typename x_mode_result<_Mode>::type parser_padded(const _CharType*& psz, const _CharType* const pszEnd) noexcept
+	{
+		return parser_padded<_Mode>(psz, pszEnd, x_cpu_dispatch<>::level);
+	}
+
+	// Same as parser_exact(), with the grammar of _Policy rather than
+	// default_policy: parser_policy<fast_double_parser::json_policy>(p, e)
+	// refuses "+1", "01", ".5" and "5.". Only the branches that _Policy
+	// needs are compiled. _Mode picks the result as in parser_padded().
+	template<class _Policy, x_parse_mode _Mode = x_mode_exact, class _CharType>
+	really_inline
+	typename x_mode_result<_Mode>::type parser_policy(const _CharType*& psz, const _CharType* const pszEnd, cpu_level level) noexcept
+	{
+		return x_parser<_Mode, false, false, _Policy>(psz, pszEnd, level);
+	}
+
+	template<class _Policy, x_parse_mode _Mode = x_mode_exact, class _CharType>
+	really_inline
+	typename x_mode_result<_Mode>::type parser_policy(const _CharType*& psz, const _CharType* const pszEnd) noexcept
+	{
+		return parser_policy<_Policy, _Mode>(psz, pszEnd, x_cpu_dispatch<>::level);
+	}
+
+	// Hexadecimal floating-point numbers, as printed by %a:
+	// 0x1.91eb851eb851fp+1, with the syntax of
+	// fast_double_parser::parse_hex_base and '.' as the separator. The
+	// result is always correctly rounded (parser_result::Double).
+	template<class _CharType>
+	really_inline
+	std::tuple<number_value, parser_result> parser_hex(const _CharType*& psz, const _CharType* const pszEnd, cpu_level level) noexcept
+	{
+		return x_parser<x_mode_exact, true>(psz, pszEnd, level);
+	}
+
+	template<class _CharType>
+	really_inline
+	std::tuple<number_value, parser_result> parser_hex(const _CharType*& psz, const _CharType* const pszEnd) noexcept
+	{
+		return parser_hex(psz, pszEnd, x_cpu_dispatch<>::level);
+	}
+
+	// Same as parser_hex(), rounded to a float (parser_result::Float).
+	template<class _CharType>
+	really_inline
+	std::tuple<number_value, parser_result> parser_hex_float(const _CharType*& psz, const _CharType* const pszEnd, cpu_level level) noexcept
+	{
+		return x_parser<x_mode_float, true>(psz, pszEnd, level);
+	}
+
+	template<class _CharType>
+	really_inline
+	std::tuple<number_value, parser_result> parser_hex_float(const _CharType*& psz, const _CharType* const pszEnd) noexcept
+	{
+		return parser_hex_float(psz, pszEnd, x_cpu_dispatch<>::level);
 	}
 }
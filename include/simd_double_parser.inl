@@ -1,4 +1,27 @@
 
+//ļᱻsimd_double_parser.hָͬһΣÿηڲֿͬռ
+//ǰҪSIMD_DOUBLE_PARSER_ISAļڵкָ
+#if SIMD_DOUBLE_PARSER_ISA > SIMD_DOUBLE_PARSER_ISA_SSE2
+#if defined(__clang__)
+#if SIMD_DOUBLE_PARSER_ISA == SIMD_DOUBLE_PARSER_ISA_AVX2
+#pragma clang attribute push (__attribute__((target("avx2,bmi"))), apply_to = function)
+#elif SIMD_DOUBLE_PARSER_ISA == SIMD_DOUBLE_PARSER_ISA_SSE41
+#pragma clang attribute push (__attribute__((target("sse4.1"))), apply_to = function)
+#else
+#pragma clang attribute push (__attribute__((target("ssse3"))), apply_to = function)
+#endif
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#if SIMD_DOUBLE_PARSER_ISA == SIMD_DOUBLE_PARSER_ISA_AVX2
+#pragma GCC target("avx2,bmi")
+#elif SIMD_DOUBLE_PARSER_ISA == SIMD_DOUBLE_PARSER_ISA_SSE41
+#pragma GCC target("sse4.1")
+#else
+#pragma GCC target("ssse3")
+#endif
+#endif
+#endif
+
 namespace
 {
 /*
@@ -77,6 +100,39 @@ namespace
 		return val;
 	}
 
+	//pʼnֽڣǷ񲻻Խ4Kҳ߽硣ֻʣ಻nֽʱã
+	//ASanԽĩβļؼʹҳҲᱨʱǷfalseַƵջϵ㷨
+	really_inline bool x_is_safe_load(const void* p, size_t n) noexcept
+	{
+#ifdef SIMD_DOUBLE_PARSER_ASAN
+		(void)p;
+		(void)n;
+		return false;
+#else
+		return ((uintptr_t)p & 4095) <= 4096 - n;
+#endif
+	}
+
+	//ģʽ(_Padded)£֮FAST_DOUBLE_PARSER_PADDINGɶַpszEnd֮ǰͽˣ
+	//ɨʱַ߽磬ֻһ
+	template<bool _Padded, class _CharType>
+	really_inline bool x_before_end(const _CharType* psz, const _CharType* pszEnd) noexcept
+	{
+		return _Padded || psz < pszEnd;
+	}
+
+	//xλ1λáxΪ0
+	really_inline uint32_t x_ctz_u32(uint32_t x) noexcept
+	{
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, x);
+		return (uint32_t)index;
+#else
+		return (uint32_t)__builtin_ctz(x);
+#endif
+	}
+
 	//жxǲһĸ([0,9]֮ĸ)
 #ifndef x_is_digit
 	template<class _Ch>
@@ -99,23 +155,23 @@ namespace
 	{
 		using type = char16_t;
 
+		//4ĸÿĸռһ16λͨsض
 		static really_inline __m128i load_xdigitx4(const type* s) noexcept
 		{
-#if defined(_M_X64) || defined(__x86_64__)
-			return _mm_cvtsi64_si128(*(int64_t*)s);
-#elif defined(_M_IX86) || defined(__i386__)
-			const int32_t* v = (const int32_t*)(s);
-			return _mm_set_epi32(0, 0, v[1], v[0]);
-#else
-#error "Unknown platform"
-#endif
+			return _mm_loadl_epi64((const __m128i*)s);
 		}
 
-		//8ĸ
+		//8ĸsض
 		//i16x8128λֵ
 		static really_inline __m128i load_xdigitx8(const type* s) noexcept
 		{
-			return _mm_load_si128((const __m128i*)s);
+			return _mm_loadu_si128((const __m128i*)s);
+		}
+
+		//cvt_xcharx4_i32õĳaӦ4ĸdӦ1ĸ
+		static really_inline __m128i mul_xdigitx4(int16_t a, int16_t b, int16_t c, int16_t d) noexcept
+		{
+			return _mm_set_epi16(0, 0, 0, 0, a, b, c, d);
 		}
 
 		//i16x4816λĸ
@@ -143,10 +199,10 @@ namespace
 
 		//416λĸ(Ը416λĸתһ9999
 		//i16x4_mul416λ(416λֱ趨Ϊ0)Ҫ趨תٸĸ:
-		//	4ĸ : _mm_set_epi16(0, 0, 0, 0, 1, 10, 100, 1000)
-		//	3ĸ : _mm_set_epi16(0, 0, 0, 0, 0, 1, 10, 100)
-		//	2ĸ : _mm_set_epi16(0, 0, 0, 0, 0, 0, 1, 10)
-		//	1ĸ : _mm_set_epi16(0, 0, 0, 0, 0, 0, 0, 1)
+		//	4ĸ : mul_xdigitx4(1, 10, 100, 1000)
+		//	3ĸ : mul_xdigitx4(0, 1, 10, 100)
+		//	2ĸ : mul_xdigitx4(0, 0, 1, 10)
+		//	1ĸ : mul_xdigitx4(0, 0, 0, 1)
 		//r = (i16x4[0]-'0')*i16x4_mul[0] + (i16x4[1]-'0')*i16x4_mul[1] + (i16x4[2]-'0')*i16x4_mul[2] + (i16x4[3]-'0')*i16x4_mul[3]
 		static really_inline uint32_t cvt_xcharx4_i32(__m128i i16x4, __m128i i16x4_mul) noexcept
 		{
@@ -166,31 +222,34 @@ namespace
 		};
 	};
 
+	//ֽĸغչ16λ֮ͨжϺתchar16_tͬ
 	template<>
-	struct x_convert_char_selector<1>
+	struct x_convert_char_selector<1> : x_convert_char_selector<2>
 	{
 		using type = char;
 
 		static really_inline __m128i load_xdigitx4(const type* s) noexcept
 		{
-			__m128i i8x8 = _mm_cvtsi32_si128(*(int*)s);
+			int32_t v;
+			memcpy(&v, s, sizeof(v));	//sض
+			__m128i i8x8 = _mm_cvtsi32_si128(v);
+#if SIMD_DOUBLE_PARSER_ISA >= SIMD_DOUBLE_PARSER_ISA_SSE41
+			return _mm_cvtepu8_epi16(i8x8);
+#else
 			return _mm_unpacklo_epi8(i8x8, _mm_setzero_si128());
+#endif
 		}
 
 		//8ĸ
 		//i16x8128λֵ
 		static really_inline __m128i load_xdigitx8(const type* s) noexcept
 		{
-			__m128i i8x8;
-#if defined(_M_X64) || defined(__x86_64__)
-			i8x8 = _mm_cvtsi64_si128(*(int64_t*)s);
-#elif defined(_M_IX86) || defined(__i386__)
-			const int32_t* v = (const int32_t*)(s);
-			i8x8 = _mm_set_epi32(0, 0, v[1], v[0]);
+			__m128i i8x8 = _mm_loadl_epi64((const __m128i*)s);	//sض
+#if SIMD_DOUBLE_PARSER_ISA >= SIMD_DOUBLE_PARSER_ISA_SSE41
+			return _mm_cvtepu8_epi16(i8x8);
 #else
-#error "Unknown platform"
-#endif
 			return _mm_unpacklo_epi8(i8x8, _mm_setzero_si128());
+#endif
 		}
 	};
 
@@ -199,20 +258,70 @@ namespace
 	{
 		using type = char32_t;
 
+		//4ĸÿĸռһ32λͨ(ѹ16λжʱֱӱȽ32λ)sض
 		static really_inline __m128i load_xdigitx4(const type* s) noexcept
 		{
-			__m128i lo = _mm_load_si128((__m128i*)s);
-			return _mm_packs_epi32(lo, _mm_setzero_si128());
+			return _mm_loadu_si128((const __m128i*)s);
 		}
 
+		//8ĸѹi16x8x_mm_cvt_i16x8_i3216λתásض
 		static really_inline __m128i load_xdigitx8(const type* s) noexcept
 		{
-			__m128i lo = _mm_load_si128((__m128i*)s);
-			__m128i hi = _mm_load_si128(((__m128i*)s) + 1);
+			__m128i lo = _mm_loadu_si128((const __m128i*)s);
+			__m128i hi = _mm_loadu_si128(((const __m128i*)s) + 1);
 			return _mm_packs_epi32(lo, hi);
 		}
+
+		static really_inline __m128i mul_xdigitx4(int32_t a, int32_t b, int32_t c, int32_t d) noexcept
+		{
+			return _mm_set_epi32(a, b, c, d);
+		}
+
+		//i32x4432λĸr.bits[4*i .. 4*i+3] = is_digit(i32x4[i])
+		//0x7fffffffĸзűȽǸᱻ
+		static really_inline uint32_t digit_mask(__m128i i32x4) noexcept
+		{
+			__m128i i32x4_gt = _mm_cmpgt_epi32(i32x4, _mm_set1_epi32('0' - 1));
+			__m128i i32x4_lt = _mm_cmplt_epi32(i32x4, _mm_set1_epi32('9' + 1));
+			return _mm_movemask_epi8(_mm_and_si128(i32x4_gt, i32x4_lt));
+		}
+		static really_inline uint32_t digit_zero_mask(__m128i i32x4) noexcept
+		{
+			return _mm_movemask_epi8(_mm_cmpeq_epi32(i32x4, _mm_set1_epi32('0')));
+		}
+
+		//ͬx_convert_char_selector<2>::cvt_xcharx4_i32ֻÿĸͳ32λġ
+		//ȥ'0'Ժÿͨĸ16λΪ0_mm_madd_epi16õõÿͨĳ˻
+		static really_inline uint32_t cvt_xcharx4_i32(__m128i i32x4, __m128i i32x4_mul) noexcept
+		{
+			i32x4 = _mm_sub_epi32(i32x4, _mm_set1_epi32('0'));
+			return _mm_cvtsi128_si32(x_mm_dotp_i16x8(i32x4, i32x4_mul));
+		}
+
+		enum
+		{
+			MASK4 = 0xffff,
+			MASK3 = 0x0fff,
+			MASK2 = 0x00ff,
+			MASK1 = 0x000f,
+		};
 	};
 
+	//sʼ4ַremaindǵĩβʣַ4ֱӼػԽ4Kҳ߽ʱ(һҳδؿɶ)
+	//ȰʣµַƵջ(0)ټء㿽[begin, end)ʱδӳҳ
+	template<class traits_t>
+	really_inline __m128i x_load_xdigitx4_safe(const typename traits_t::type* s, intptr_t remaind) noexcept
+	{
+		using type = typename traits_t::type;
+		if (unlikely(remaind < 4 && !x_is_safe_load(s, 4 * sizeof(type))))
+		{
+			alignas(16) type tmp[4] = {};
+			for (intptr_t i = 0; i < remaind; ++i) tmp[i] = s[i];
+			return traits_t::load_xdigitx4(tmp);
+		}
+		return traits_t::load_xdigitx4(s);
+	}
+
 	//8ַתλ"12345678"ת12345678
 	template<class type>
 	really_inline int64_t x_mm_convert_digitx8_long(int64_t result, const type* s) noexcept
@@ -231,7 +340,7 @@ namespace
 		using traits_t = x_convert_char_selector<sizeof(type)>;
 
 		__m128i i16x8 = traits_t::load_xdigitx4((typename traits_t::type*)s);
-		int val = x_mm_cvt_i16x4_i32(i16x8);
+		int val = traits_t::cvt_xcharx4_i32(i16x8, traits_t::mul_xdigitx4(1000, 100, 10, 1));
 		return val;
 	}
 
@@ -253,74 +362,76 @@ namespace
 	}
 
 	//ַתΪ
-	//ַ߳int64_tɱķΧֹͣ
+	//ַ߳_Limit::MAX(x_int64_limitx_uint64_limit)ֹͣ
 	//psz:Ҫתַ
 	//overflow:Ϊtrue򣬲ıoverflowֵ
 	//ֵ:Ѿת
-	template<class type>
-	really_inline uint64_t x_mm_convert_string_long(uint64_t result, const type*& psz, const type* e, bool& overflow) noexcept
+	template<bool _Padded, class type, class _Limit>
+	really_inline uint64_t x_mm_convert_string_long(uint64_t result, const type*& psz, const type* e, bool& overflow, _Limit) noexcept
 	{
 		using traits_t = x_convert_char_selector<sizeof(type)>;
-		using traits16_t = x_convert_char_selector<2>;
 
-		constexpr uint64_t MAX_LONG = (std::numeric_limits<int64_t>::max)();
+		constexpr uint64_t MAX_LONG = _Limit::MAX;
 		constexpr uint64_t LIMIT_LONG_9999 = (MAX_LONG - 9999) / 10000;
 		constexpr uint64_t LIMIT_LONG_999 = (MAX_LONG - 999) / 1000;
 		constexpr uint64_t LIMIT_LONG_99 = (MAX_LONG - 99) / 100;
 		constexpr uint64_t LIMIT_LONG_9 = (MAX_LONG - 9) / 10;
+		//ַʱ飺result * 10 + val <= MAX_LONG
+		constexpr uint64_t LIMIT_LONG_D = MAX_LONG / 10;
+		constexpr uint32_t LIMIT_DIGIT = (uint32_t)(MAX_LONG % 10);
 
 		const type* s = psz;
-		for (; s < e; )
+		for (; x_before_end<_Padded>(s, e); )
 		{
-			intptr_t remaind = e - s;
+			intptr_t remaind = _Padded ? 4 : e - s;
 
 			uint32_t mask;
-			__m128i i16x4 = traits_t::load_xdigitx4(s);
+			__m128i i16x4 = x_load_xdigitx4_safe<traits_t>(s, remaind);
 /*
-			mask = traits16_t::digit_zero_mask(i16x4);
-			if (mask == traits16_t::MASK4)
+			mask = traits_t::digit_zero_mask(i16x4);
+			if (mask == traits_t::MASK4)
 			{
 				s += (std::min)(remaind, (intptr_t)4);
 				continue;
 			}
-			else if (mask == traits16_t::MASK3)
+			else if (mask == traits_t::MASK3)
 			{
 				s += (std::min)(remaind, (intptr_t)3);
 				continue;
 			}
 */
 
-			mask = traits16_t::digit_mask(i16x4);
-			if (mask == traits16_t::MASK4 && remaind >= 4)
+			mask = traits_t::digit_mask(i16x4);
+			if (mask == traits_t::MASK4 && remaind >= 4)
 			{
 				if (result > LIMIT_LONG_9999) break;
 
-				uint32_t val = traits16_t::cvt_xcharx4_i32(i16x4, _mm_set_epi16(0, 0, 0, 0, 1, 10, 100, 1000));
+				uint32_t val = traits_t::cvt_xcharx4_i32(i16x4, traits_t::mul_xdigitx4(1, 10, 100, 1000));
 				result = result * 10000 + val;
 				s += 4;
 			}
-			else if ((mask & traits16_t::MASK3) == traits16_t::MASK3 && remaind >= 3)
+			else if ((mask & traits_t::MASK3) == traits_t::MASK3 && remaind >= 3)
 			{
 				if (result > LIMIT_LONG_999) break;
 
-				uint32_t val = traits16_t::cvt_xcharx4_i32(i16x4, _mm_set_epi16(0, 0, 0, 0, 0, 1, 10, 100));
+				uint32_t val = traits_t::cvt_xcharx4_i32(i16x4, traits_t::mul_xdigitx4(0, 1, 10, 100));
 				result = result * 1000 + val;
 
 				psz = s + 3;
 				return result;
 			}
-			else if ((mask & traits16_t::MASK2) == traits16_t::MASK2 && remaind >= 2)
+			else if ((mask & traits_t::MASK2) == traits_t::MASK2 && remaind >= 2)
 			{
 				if (result > LIMIT_LONG_99) break;
 
-				//uint32_t val = traits16_t::cvt_xcharx4_i32(i8x4, _mm_set_epi16(0, 0, 0, 0, 0, 0, 1, 10));
+				//uint32_t val = traits_t::cvt_xcharx4_i32(i8x4, traits_t::mul_xdigitx4(0, 0, 1, 10));
 				uint32_t val = (s[0] - (type)'0') * 10 + (s[1] - (type)'0');
 				result = result * 100 + val;
 
 				psz = s + 2;
 				return result;
 			}
-			else if ((mask & traits16_t::MASK1) == traits16_t::MASK1)
+			else if ((mask & traits_t::MASK1) == traits_t::MASK1)
 			{
 				if (result > LIMIT_LONG_9) break;
 
@@ -337,18 +448,18 @@ namespace
 			}
 		}
 
-		for (; s < e && x_is_digit(*s); ++s)
+		for (; x_before_end<_Padded>(s, e) && x_is_digit(*s); ++s)
 		{
-			if (result >= 0x0CCCCCCCCCCCCCCCULL)	// 2^63 = 9223372036854775808
+			uint32_t val = *s - (type)'0';
+			if (result >= LIMIT_LONG_D)
 			{
-				if (result != 0x0CCCCCCCCCCCCCCCULL || *s >= (type)'8')
+				if (result != LIMIT_LONG_D || val > LIMIT_DIGIT)
 				{
 					overflow = true;
 					break;
 				}
 			}
 
-			uint32_t val = *s - (type)'0';
 			result = result * 10 + val;
 		}
 
@@ -356,170 +467,796 @@ namespace
 		return result;
 	}
 
-	template<class type>
-	really_inline int64_t x_mm_convert_string_long2(int64_t result, const type*& psz, const type* e, bool& overflow) noexcept
+	//ֵǧλָ֮飺pszָָÿǷָ3֣ۼӵi64
+	//ÿֻһ飻ʱִ(uint64_t)Ժֻexptruncated
+	//ʽʱfalsepszָλ
+	template<bool _Padded, class _Policy, class type>
+	really_inline bool x_mm_convert_groups(uint64_t& i64, const type*& psz, const type* e, bool& useDouble, bool& truncated, intptr_t& exp) noexcept
+	{
+		while (x_before_end<_Padded>(psz, e) && fast_double_parser::is_group_separator<_Policy>(*psz))
+		{
+			if (!((_Padded || e - psz > 3) && x_is_digit(psz[1]) && x_is_digit(psz[2]) && x_is_digit(psz[3])))
+				return false;
+			if (!useDouble && i64 <= x_uint64_limit::limit_e(3))
+			{
+				i64 = i64 * 1000 + (uint32_t)(psz[1] - (type)'0') * 100 + (uint32_t)(psz[2] - (type)'0') * 10 + (uint32_t)(psz[3] - (type)'0');
+			}
+			else
+			{
+				for (int k = 1; k <= 3; ++k)
+				{
+					uint32_t val = psz[k] - (type)'0';
+					if (!useDouble && i64 <= (UINT64_MAX - val) / 10)
+					{
+						i64 = i64 * 10 + val;
+					}
+					else
+					{
+						useDouble = true;
+						truncated |= val != 0;
+						++exp;
+					}
+				}
+			}
+			psz += 4;
+		}
+		return true;
+	}
+
+	really_inline double x_fast_path(double significand, intptr_t exp) noexcept
 	{
-		constexpr int64_t MAX_LONG = (std::numeric_limits<int64_t>::max)();
-		constexpr int64_t LIMIT_LONG_9999 = (MAX_LONG - 9999) / 10000;
-		constexpr int64_t LIMIT_LONG_999 = (MAX_LONG - 999) / 1000;
-		constexpr int64_t LIMIT_LONG_99 = (MAX_LONG - 99) / 100;
-		constexpr int64_t LIMIT_LONG_9 = (MAX_LONG - 9) / 10;
+		assert(exp >= -308 && exp <= 308);
 
-		const type* s = psz;
-		for (; s < e && x_is_digit(*s); ++s)
+#ifdef FAST_DOUBLE_PARSER_COMPACT_TABLES
+		//ձģʽûDOUBLE_E/DOUBLE_NEfast_double_parserĽձ㣻1e-308Ǵ
+		if (exp < -307)
+			return significand * 1e-308;
+		return significand * fast_double_parser::compact_power_of_ten_to_double(exp);
+#else
+		if (exp >= 0)
+			return significand * DOUBLE_E[exp];
+		else
+			return significand * DOUBLE_NE[-exp];
+#endif
+	}
+
+	//ѾķšЧֺʮָս
+	//useDouble=falseʱi64(2^64-12^63)Ϊ i64 * 10^exp
+	really_inline std::tuple<number_value, parser_result> x_make_number(bool minus, bool useDouble, uint64_t i64, intptr_t exp) noexcept
+	{
+		if (useDouble)
 		{
-			//int64_t::max=2^63-1
-			//2 ^ 63 = 9223372036854775808
-			//2 ^ 62 = 922337203685477580 = 0x0CCCCCCCCCCCCCCC
-			if (unlikely(result >= 0x0CCCCCCCCCCCCCCCULL))
+			double dval;
+/*
+			bool success = true;
+			dval = fast_double_parser::compute_float_64(exp, i64, false, &success);
+			if (!success)
+*/
 			{
-				if (result != 0x0CCCCCCCCCCCCCCCULL || *s >= (type)'8')
+				if (i64 == 0 || exp < -330)	//330 = 308 + 22; Чȫ0ʱָ󣬽(ŵ)0
 				{
-					overflow = true;
-					break;
+					dval = 0.0;
+				}
+				else if (exp < -308)
+				{
+					dval = x_fast_path((double)i64, -308);
+					dval = x_fast_path(dval, exp + 308);
+				}
+				else if (exp > 330)	//330 = 308 + 22
+				{
+					dval = INFINITY;
+				}
+				else if (exp > 308)
+				{
+					dval = x_fast_path((double)i64, 308);
+					dval = x_fast_path(dval, exp - 308);
+				}
+				else if (exp != 0)
+				{
+					dval = x_fast_path((double)i64, exp);
+				}
+				else
+				{
+					dval = (double)i64;
 				}
 			}
 
-			int val = *s - (type)'0';
-			result = result * 10 + val;
+			number_value nv;
+			nv.d = minus ? -dval : dval;
+
+			return { nv, parser_result::Double };
 		}
+		else if (!minus)
+		{
+			number_value nv;
+			nv.ul = i64;
 
-		psz = s;
-		return result;
+			return { nv, i64 > (uint64_t)(std::numeric_limits<int64_t>::max)() ? parser_result::ULong : parser_result::Long };
+		}
+		else
+		{//֤߱i64 <= 2^63-2^63Ҳint64_t
+			number_value nv;
+			nv.l = (int64_t)(0 - i64);
+
+			return { nv, parser_result::Long };
+		}
 	}
 
-	static const double DOUBLE_E[] =
-	{ // 1e-0...1e308: 309 * 8 bytes = 2472 bytes
-		1e+0,
-		1e+1,  1e+2,  1e+3,  1e+4,  1e+5,  1e+6,  1e+7,  1e+8,  1e+9,  1e+10, 1e+11, 1e+12, 1e+13, 1e+14, 1e+15, 1e+16, 1e+17, 1e+18, 1e+19, 1e+20,
-		1e+21, 1e+22, 1e+23, 1e+24, 1e+25, 1e+26, 1e+27, 1e+28, 1e+29, 1e+30, 1e+31, 1e+32, 1e+33, 1e+34, 1e+35, 1e+36, 1e+37, 1e+38, 1e+39, 1e+40,
-		1e+41, 1e+42, 1e+43, 1e+44, 1e+45, 1e+46, 1e+47, 1e+48, 1e+49, 1e+50, 1e+51, 1e+52, 1e+53, 1e+54, 1e+55, 1e+56, 1e+57, 1e+58, 1e+59, 1e+60,
-		1e+61, 1e+62, 1e+63, 1e+64, 1e+65, 1e+66, 1e+67, 1e+68, 1e+69, 1e+70, 1e+71, 1e+72, 1e+73, 1e+74, 1e+75, 1e+76, 1e+77, 1e+78, 1e+79, 1e+80,
-		1e+81, 1e+82, 1e+83, 1e+84, 1e+85, 1e+86, 1e+87, 1e+88, 1e+89, 1e+90, 1e+91, 1e+92, 1e+93, 1e+94, 1e+95, 1e+96, 1e+97, 1e+98, 1e+99, 1e+100,
-		1e+101,1e+102,1e+103,1e+104,1e+105,1e+106,1e+107,1e+108,1e+109,1e+110,1e+111,1e+112,1e+113,1e+114,1e+115,1e+116,1e+117,1e+118,1e+119,1e+120,
-		1e+121,1e+122,1e+123,1e+124,1e+125,1e+126,1e+127,1e+128,1e+129,1e+130,1e+131,1e+132,1e+133,1e+134,1e+135,1e+136,1e+137,1e+138,1e+139,1e+140,
-		1e+141,1e+142,1e+143,1e+144,1e+145,1e+146,1e+147,1e+148,1e+149,1e+150,1e+151,1e+152,1e+153,1e+154,1e+155,1e+156,1e+157,1e+158,1e+159,1e+160,
-		1e+161,1e+162,1e+163,1e+164,1e+165,1e+166,1e+167,1e+168,1e+169,1e+170,1e+171,1e+172,1e+173,1e+174,1e+175,1e+176,1e+177,1e+178,1e+179,1e+180,
-		1e+181,1e+182,1e+183,1e+184,1e+185,1e+186,1e+187,1e+188,1e+189,1e+190,1e+191,1e+192,1e+193,1e+194,1e+195,1e+196,1e+197,1e+198,1e+199,1e+200,
-		1e+201,1e+202,1e+203,1e+204,1e+205,1e+206,1e+207,1e+208,1e+209,1e+210,1e+211,1e+212,1e+213,1e+214,1e+215,1e+216,1e+217,1e+218,1e+219,1e+220,
-		1e+221,1e+222,1e+223,1e+224,1e+225,1e+226,1e+227,1e+228,1e+229,1e+230,1e+231,1e+232,1e+233,1e+234,1e+235,1e+236,1e+237,1e+238,1e+239,1e+240,
-		1e+241,1e+242,1e+243,1e+244,1e+245,1e+246,1e+247,1e+248,1e+249,1e+250,1e+251,1e+252,1e+253,1e+254,1e+255,1e+256,1e+257,1e+258,1e+259,1e+260,
-		1e+261,1e+262,1e+263,1e+264,1e+265,1e+266,1e+267,1e+268,1e+269,1e+270,1e+271,1e+272,1e+273,1e+274,1e+275,1e+276,1e+277,1e+278,1e+279,1e+280,
-		1e+281,1e+282,1e+283,1e+284,1e+285,1e+286,1e+287,1e+288,1e+289,1e+290,1e+291,1e+292,1e+293,1e+294,1e+295,1e+296,1e+297,1e+298,1e+299,1e+300,
-		1e+301,1e+302,1e+303,1e+304,1e+305,1e+306,1e+307,1e+308
-	};
+	//ȷģʽսstrtodĽȫһ
+	//truncated=trueʾз0򳬹19λʱi64 * 10^expֻǽֵ(ƫС)
+	//[b, e)ִ_Policy﷨޷ֱȷĽʱfast_double_parser::parse_float_slow
+	template<class _Policy, class _CharType>
+	really_inline std::tuple<number_value, parser_result> x_make_number_exact(bool minus, bool useDouble, bool truncated, uint64_t i64, intptr_t exp, const _CharType* b, const _CharType* e) noexcept
+	{
+		if (!useDouble)
+			return x_make_number(minus, useDouble, i64, exp);
 
-	static const double DOUBLE_NE[] =
-	{ // 1e-0...1e308: 309 * 8 bytes = 2472 bytes
-		1e-0,
-		1e-1,  1e-2,  1e-3,  1e-4,  1e-5,  1e-6,  1e-7,  1e-8,  1e-9,  1e-10, 1e-11, 1e-12, 1e-13, 1e-14, 1e-15, 1e-16, 1e-17, 1e-18, 1e-19, 1e-20,
-		1e-21, 1e-22, 1e-23, 1e-24, 1e-25, 1e-26, 1e-27, 1e-28, 1e-29, 1e-30, 1e-31, 1e-32, 1e-33, 1e-34, 1e-35, 1e-36, 1e-37, 1e-38, 1e-39, 1e-40,
-		1e-41, 1e-42, 1e-43, 1e-44, 1e-45, 1e-46, 1e-47, 1e-48, 1e-49, 1e-50, 1e-51, 1e-52, 1e-53, 1e-54, 1e-55, 1e-56, 1e-57, 1e-58, 1e-59, 1e-60,
-		1e-61, 1e-62, 1e-63, 1e-64, 1e-65, 1e-66, 1e-67, 1e-68, 1e-69, 1e-70, 1e-71, 1e-72, 1e-73, 1e-74, 1e-75, 1e-76, 1e-77, 1e-78, 1e-79, 1e-80,
-		1e-81, 1e-82, 1e-83, 1e-84, 1e-85, 1e-86, 1e-87, 1e-88, 1e-89, 1e-90, 1e-91, 1e-92, 1e-93, 1e-94, 1e-95, 1e-96, 1e-97, 1e-98, 1e-99, 1e-100,
-		1e-101,1e-102,1e-103,1e-104,1e-105,1e-106,1e-107,1e-108,1e-109,1e-110,1e-111,1e-112,1e-113,1e-114,1e-115,1e-116,1e-117,1e-118,1e-119,1e-120,
-		1e-121,1e-122,1e-123,1e-124,1e-125,1e-126,1e-127,1e-128,1e-129,1e-130,1e-131,1e-132,1e-133,1e-134,1e-135,1e-136,1e-137,1e-138,1e-139,1e-140,
-		1e-141,1e-142,1e-143,1e-144,1e-145,1e-146,1e-147,1e-148,1e-149,1e-150,1e-151,1e-152,1e-153,1e-154,1e-155,1e-156,1e-157,1e-158,1e-159,1e-160,
-		1e-161,1e-162,1e-163,1e-164,1e-165,1e-166,1e-167,1e-168,1e-169,1e-170,1e-171,1e-172,1e-173,1e-174,1e-175,1e-176,1e-177,1e-178,1e-179,1e-180,
-		1e-181,1e-182,1e-183,1e-184,1e-185,1e-186,1e-187,1e-188,1e-189,1e-190,1e-191,1e-192,1e-193,1e-194,1e-195,1e-196,1e-197,1e-198,1e-199,1e-200,
-		1e-201,1e-202,1e-203,1e-204,1e-205,1e-206,1e-207,1e-208,1e-209,1e-210,1e-211,1e-212,1e-213,1e-214,1e-215,1e-216,1e-217,1e-218,1e-219,1e-220,
-		1e-221,1e-222,1e-223,1e-224,1e-225,1e-226,1e-227,1e-228,1e-229,1e-230,1e-231,1e-232,1e-233,1e-234,1e-235,1e-236,1e-237,1e-238,1e-239,1e-240,
-		1e-241,1e-242,1e-243,1e-244,1e-245,1e-246,1e-247,1e-248,1e-249,1e-250,1e-251,1e-252,1e-253,1e-254,1e-255,1e-256,1e-257,1e-258,1e-259,1e-260,
-		1e-261,1e-262,1e-263,1e-264,1e-265,1e-266,1e-267,1e-268,1e-269,1e-270,1e-271,1e-272,1e-273,1e-274,1e-275,1e-276,1e-277,1e-278,1e-279,1e-280,
-		1e-281,1e-282,1e-283,1e-284,1e-285,1e-286,1e-287,1e-288,1e-289,1e-290,1e-291,1e-292,1e-293,1e-294,1e-295,1e-296,1e-297,1e-298,1e-299,1e-300,
-		1e-301,1e-302,1e-303,1e-304,1e-305,1e-306,1e-307,1e-308
-	};
+		number_value nv;
+		if (i64 == 0 || exp < FASTFLOAT_SMALLEST_POWER)
+		{//Чȫ0(ָ)С(i64 + 1) * 10^expСһ룬(ŵ)0
+			nv.d = minus ? -0.0 : 0.0;
+			return { nv, parser_result::Double };
+		}
 
-	static const int64_t LONG_E[] =
-	{
-		1,
-		10,
-		100,
-		1000,
-		10000,
-		100000,
-		1000000,
-		10000000,
-		100000000,
-		1000000000,
-		10000000000,
-		100000000000,
-		1000000000000,
-		10000000000000,
-		100000000000000,
-		1000000000000000,
-		10000000000000000,
-	};
+		if (exp >= FASTFLOAT_SMALLEST_POWER && exp <= FASTFLOAT_LARGEST_POWER)
+		{
+			bool success = true;
+			nv.d = fast_double_parser::compute_float_64(exp, i64, minus, &success);
+			if (truncated && success)
+			{//ʵֵi64 * 10^exp(i64 + 1) * 10^exp֮䣬ͬʱʵֵҲͬ
+				bool success_up = true;
+				double up = fast_double_parser::compute_float_64(exp, i64 + 1, minus, &success_up);
+				success = success_up && up == nv.d;
+			}
+			if (success)
+				return { nv, parser_result::Double };
+		}
 
-	really_inline double x_fast_path(double significand, intptr_t exp) noexcept
+		nv.d = fast_double_parser::parse_float_slow<double, _Policy>(b, e);
+		return { nv, parser_result::Double };
+	}
+
+	//x_make_number_exactͬfloatstrtofĽȫһ¡
+	//ֱӴʮ뵽float뵽doubleתfloat
+	template<class _Policy, class _CharType>
+	really_inline std::tuple<number_value, parser_result> x_make_number_float(bool minus, bool useDouble, bool truncated, uint64_t i64, intptr_t exp, const _CharType* b, const _CharType* e) noexcept
 	{
-		assert(exp >= -308 && exp <= 308);
+		if (!useDouble)
+			return x_make_number(minus, useDouble, i64, exp);
 
-		if (exp >= 0)
-			return significand * DOUBLE_E[exp];
+		number_value nv;
+		if (i64 == 0 || exp < FASTFLOAT_SMALLEST_POWER_32)
+		{
+			nv.f = minus ? -0.0f : 0.0f;
+			return { nv, parser_result::Float };
+		}
+
+		if (exp <= FASTFLOAT_LARGEST_POWER_32)
+		{
+			bool success = true;
+			nv.f = fast_double_parser::compute_float_32(exp, i64, minus, &success);
+			if (truncated && success)
+			{
+				bool success_up = true;
+				float up = fast_double_parser::compute_float_32(exp, i64 + 1, minus, &success_up);
+				success = success_up && up == nv.f;
+			}
+			if (success)
+				return { nv, parser_result::Float };
+		}
+
+		nv.f = fast_double_parser::parse_float_slow<float, _Policy>(b, e);
+		return { nv, parser_result::Float };
+	}
+
+	template<x_parse_mode _Mode, class _Policy, class _CharType>
+	really_inline typename std::enable_if<_Mode != x_mode_decimal, std::tuple<number_value, parser_result>>::type x_make_number_mode(bool minus, bool useDouble, bool truncated, uint64_t i64, intptr_t exp, const _CharType* b, const _CharType* e) noexcept
+	{
+		if (unlikely(!useDouble && minus && i64 > ((uint64_t)1 << 63)))
+			useDouble = true;	//int64_tСֵСֻø
+
+		if (_Mode == x_mode_float)
+			return x_make_number_float<_Policy>(minus, useDouble, truncated, i64, exp, b, e);
+		else if (_Mode == x_mode_exact)
+			return x_make_number_exact<_Policy>(minus, useDouble, truncated, i64, exp, b, e);
 		else
-			return significand * DOUBLE_NE[-exp];
+			return x_make_number(minus, useDouble, i64, exp);
+	}
+
+	//x_mode_decimalκζתֱӷЧ֡ʮָźͽضϱ־(fast_double_parser::decimal_components)
+	//parser_result::Long(ָΪ0)parser_result::Double
+	template<x_parse_mode _Mode, class _Policy, class _CharType>
+	really_inline typename std::enable_if<_Mode == x_mode_decimal, std::tuple<decimal_components, parser_result>>::type x_make_number_mode(bool minus, bool useDouble, bool truncated, uint64_t i64, intptr_t exp, const _CharType*, const _CharType*) noexcept
+	{
+		decimal_components dc;
+		dc.mantissa = i64;
+		dc.exponent = exp;
+		dc.negative = minus;
+		dc.truncated = truncated;
+		return { dc, useDouble ? parser_result::Double : parser_result::Long };
+	}
+
+	//ǷĽ
+	template<x_parse_mode _Mode>
+	really_inline typename x_mode_result<_Mode>::type x_make_invalid() noexcept
+	{
+		typename x_mode_result<_Mode>::type result{};
+		std::get<1>(result) = parser_result::Invalid;
+		return result;
+	}
+
+#if SIMD_DOUBLE_PARSER_ISA >= SIMD_DOUBLE_PARSER_ISA_SSSE3
+	//i8x1616ַӵ0ַʼַĸ(0~16)
+	really_inline uint32_t x_mm_digit_count_i8x16(__m128i i8x16) noexcept
+	{
+		__m128i i8x16_sub = _mm_sub_epi8(i8x16, _mm_set1_epi8('0'));
+		__m128i i8x16_digit = _mm_cmpeq_epi8(_mm_min_epu8(i8x16_sub, _mm_set1_epi8(9)), i8x16_sub);
+		uint32_t mask = (uint32_t)_mm_movemask_epi8(i8x16_digit);
+		//16λһ֣֤~maskΪ0
+		return (uint32_t)x_ctz_u32(~mask | 0x10000);
+	}
+
+	//i8x16160~9(ַ)Ҷ롢߲0תһ
+	really_inline uint64_t x_mm_cvt_aligned_i8x16_long(__m128i i8x16) noexcept
+	{
+		__m128i i16x8 = _mm_maddubs_epi16(i8x16, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+		__m128i i32x4 = _mm_madd_epi16(i16x8, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+#if SIMD_DOUBLE_PARSER_ISA >= SIMD_DOUBLE_PARSER_ISA_SSE41
+		i16x8 = _mm_packus_epi32(i32x4, i32x4);
+#else
+		//ÿֵ9999зű޷ű͵Ľͬ
+		i16x8 = _mm_packs_epi32(i32x4, i32x4);
+#endif
+		i32x4 = _mm_madd_epi16(i16x8, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+		//i32x4[0]Ǹ8λ֣i32x4[1]ǵ8λ
+		uint64_t hi = (uint32_t)_mm_cvtsi128_si32(i32x4);
+		uint64_t lo = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(i32x4, 4));
+		return hi * 100000000 + lo;
+	}
+
+	//i8x16ǰn(n<=16)ַһת֤߱nַ
+	//pshufbnҶ(߲0)Ȼӣ
+	//	pmaddubsw : 16 -> 8λ
+	//	pmaddwd   : 8λ -> 4λ
+	//	packusdw(SSSE3packssdw) + pmaddwd : 4λ -> 2λ
+	really_inline uint64_t x_mm_cvt_i8x16_long(__m128i i8x16, uint32_t n) noexcept
+	{
+		i8x16 = _mm_sub_epi8(i8x16, _mm_set1_epi8('0'));
+
+		//Ϊ(λΪ1)ͨpshufbὫ0
+		__m128i index = _mm_add_epi8(_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm_set1_epi8((char)(n - 16)));
+		return x_mm_cvt_aligned_i8x16_long(_mm_shuffle_epi8(i8x16, index));
+	}
+
+
+	//sʼn(n<=16)ַһת֤߱nַ
+	really_inline uint64_t x_mm_convert_digitx16_long(const char* s, uint32_t n) noexcept
+	{
+		return x_mm_cvt_i8x16_long(_mm_loadu_si128((const __m128i*)s), n);
+	}
+
+	//i8x16ǰn(n<=16)ַǴǧλָ"1,234,567"",234,567"Ѿʽ
+	//ָڴ481216ַϡһpshufbָҶ룺
+	//j(j0ʼ)j + j/3ַ
+	really_inline uint64_t x_mm_cvt_grouped_i8x16_long(__m128i i8x16, uint32_t n) noexcept
+	{
+		i8x16 = _mm_sub_epi8(i8x16, _mm_set1_epi8('0'));
+
+		//Ϊͨ(֮ǰ)pshufb0
+		__m128i index = _mm_sub_epi8(_mm_set1_epi8((char)(n - 1)), _mm_setr_epi8(20, 18, 17, 16, 14, 13, 12, 10, 9, 8, 6, 5, 4, 2, 1, 0));
+		return x_mm_cvt_aligned_i8x16_long(_mm_shuffle_epi8(i8x16, index));
+	}
+
+	//x_mm_convert_string_longcharİ汾
+	//ÿμ16ַһУתÿ16ֻһ顣
+	//ʣ಻16ַ߼ػԽҳ߽硢߿ʱַ㷨
+	template<bool _Padded, class _Limit>
+	really_inline uint64_t x_mm_convert_string_long(uint64_t result, const char*& psz, const char* e, bool& overflow, _Limit limit) noexcept
+	{
+		const char* s = psz;
+		for (;;)
+		{
+			intptr_t remaind = e - s;
+			if (!_Padded && (remaind <= 0 || (remaind < 16 && !x_is_safe_load(s, 16))))
+				break;
+
+			__m128i i8x16 = _mm_loadu_si128((const __m128i*)s);
+			uint32_t n = x_mm_digit_count_i8x16(i8x16);
+			if (!_Padded && (intptr_t)n > remaind)
+				n = (uint32_t)remaind;
+			if (n == 0 || result > _Limit::limit_e(n))
+				break;
+
+			result = result * LONG_E[n] + x_mm_cvt_i8x16_long(i8x16, n);
+			s += n;
+			if (n < 16)
+			{
+				psz = s;
+				return result;
+			}
+		}
+
+		psz = s;
+		return x_mm_convert_string_long<_Padded, char>(result, psz, e, overflow, limit);
+	}
+
+	//x_mm_convert_groupscharİ汾ÿμ16ַ4",ddd"
+	//һαȽϵõֵָλ룬ͷмʽȷx_mm_cvt_grouped_i8x16_long
+	//һpshufbָkֻһ顣(ʽ)㷨
+	template<bool _Padded, class _Policy>
+	really_inline bool x_mm_convert_groups(uint64_t& i64, const char*& psz, const char* e, bool& useDouble, bool& truncated, intptr_t& exp) noexcept
+	{
+		while (!useDouble)
+		{
+			intptr_t remaind = e - psz;
+			if (!_Padded && (remaind < 4 || (remaind < 16 && !x_is_safe_load(psz, 16))))
+				break;
+
+			__m128i i8x16 = _mm_loadu_si128((const __m128i*)psz);
+			__m128i i8x16_sub = _mm_sub_epi8(i8x16, _mm_set1_epi8('0'));
+			uint32_t digit_mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(i8x16_sub, _mm_set1_epi8(9)), i8x16_sub));
+			uint32_t group_mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(i8x16, _mm_set1_epi8(_Policy::group_separator)));
+			//ÿ4λָ3ʱ0xF
+			uint32_t valid = (group_mask & 0x1111) | (digit_mask & 0xEEEE);
+			uint32_t k = x_ctz_u32(~valid | 0x10000) / 4;
+			if (!_Padded && (intptr_t)k > remaind / 4)
+				k = (uint32_t)(remaind / 4);
+			if (k == 0 || i64 > x_uint64_limit::limit_e(3 * k))
+				break;
+
+			i64 = i64 * LONG_E[3 * k] + x_mm_cvt_grouped_i8x16_long(i8x16, 4 * k);
+			psz += 4 * k;
+			if (k < 4)
+				break;
+		}
+		return x_mm_convert_groups<_Padded, _Policy, char>(i64, psz, e, useDouble, truncated, exp);
 	}
 
-	template<class _CharType>
-	std::tuple<number_value, parser_result> simd_double_parser2(const _CharType*& s, const _CharType* const pszEnd) noexcept
+	//i8x1616ַӵ0ַʼʮַ(0-9, a-f, A-F)ĸ(0~16)
+	really_inline uint32_t x_mm_xdigit_count_i8x16(__m128i i8x16) noexcept
+	{
+		__m128i i8x16_sub = _mm_sub_epi8(i8x16, _mm_set1_epi8('0'));
+		__m128i i8x16_digit = _mm_cmpeq_epi8(_mm_min_epu8(i8x16_sub, _mm_set1_epi8(9)), i8x16_sub);
+		//0x20󣬴дĸСдĸ
+		__m128i i8x16_alpha = _mm_sub_epi8(_mm_or_si128(i8x16, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+		i8x16_alpha = _mm_cmpeq_epi8(_mm_min_epu8(i8x16_alpha, _mm_set1_epi8(5)), i8x16_alpha);
+		uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_or_si128(i8x16_digit, i8x16_alpha));
+		return (uint32_t)x_ctz_u32(~mask | 0x10000);
+	}
+
+	//i8x16ǰn(n<=16)ʮַһת֤߱nַʮ
+	//Ȱÿַתɰֽ(ĸֶ9)pshufb(λǰͨ0)
+	//Ȼpmaddubswÿֽںϳһֽڣpackuswb֮64λСĽ
+	really_inline uint64_t x_mm_cvt_xdigit_i8x16_long(__m128i i8x16, uint32_t n) noexcept
+	{
+		__m128i i8x16_alpha = _mm_and_si128(_mm_cmpgt_epi8(i8x16, _mm_set1_epi8('9')), _mm_set1_epi8(9));
+		i8x16 = _mm_add_epi8(_mm_and_si128(i8x16, _mm_set1_epi8(0x0f)), i8x16_alpha);
+
+		//jͨȡn-1-jַj>=nʱΪpshufbὫ0
+		__m128i index = _mm_sub_epi8(_mm_set1_epi8((char)(n - 1)), _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+		i8x16 = _mm_shuffle_epi8(i8x16, index);
+
+		__m128i i16x8 = _mm_maddubs_epi16(i8x16, _mm_setr_epi8(1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16));
+		__m128i i8x8 = _mm_packus_epi16(i16x8, i16x8);
+
+		uint64_t lo = (uint32_t)_mm_cvtsi128_si32(i8x8);
+		uint64_t hi = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(i8x8, 4));
+		return (hi << 32) | lo;
+	}
+#endif
+
+	//ʮۻmmౣ16(keptѱĸ)
+	//ֱ֮droppedǶĸtruncated¼ûз0
+	template<class type>
+	really_inline void x_mm_convert_string_hex(const type*& psz, const type* e, uint64_t& m, int& kept, int64_t& dropped, bool& truncated) noexcept
+	{
+		fast_double_parser::parse_hex_digits(psz, e, m, kept, dropped, truncated);
+	}
+
+#if SIMD_DOUBLE_PARSER_ISA >= SIMD_DOUBLE_PARSER_ISA_SSSE3
+	//x_mm_convert_string_hexcharİ汾ÿμ16ַһУת
+	really_inline void x_mm_convert_string_hex(const char*& psz, const char* e, uint64_t& m, int& kept, int64_t& dropped, bool& truncated) noexcept
+	{
+		const char* s = psz;
+		while (kept < 16)
+		{
+			intptr_t remaind = e - s;
+			if (remaind <= 0 || (remaind < 16 && !x_is_safe_load(s, 16)))
+				break;
+
+			__m128i i8x16 = _mm_loadu_si128((const __m128i*)s);
+			uint32_t run = x_mm_xdigit_count_i8x16(i8x16);
+			if ((intptr_t)run > remaind)
+				run = (uint32_t)remaind;
+			uint32_t n = run < (uint32_t)(16 - kept) ? run : (uint32_t)(16 - kept);
+			if (n == 0)
+			{
+				psz = s;
+				return;
+			}
+
+			uint64_t val = x_mm_cvt_xdigit_i8x16_long(i8x16, n);
+			m = (n == 16) ? val : ((m << (4 * n)) | val);
+			kept += (int)n;
+			s += n;
+			if (n == run && run < 16)
+			{//ִѾ
+				psz = s;
+				return;
+			}
+		}
+
+		//ʣµ(16λҪ)
+		fast_double_parser::parse_hex_digits(s, e, m, kept, dropped, truncated);
+		psz = s;
+	}
+#endif
+
+#if SIMD_DOUBLE_PARSER_ISA >= SIMD_DOUBLE_PARSER_ISA_AVX2
+	//tzcntxΪ0ʱ32
+	really_inline uint32_t x_tzcnt_u32(uint32_t x) noexcept
+	{
+		return _tzcnt_u32(x);
+	}
+
+	//maskĵposλʼΪ1λposԵ32
+	really_inline uint32_t x_count_run(uint32_t mask, uint32_t pos) noexcept
+	{
+		return pos < 32 ? x_tzcnt_u32(~(mask >> pos)) : 0;
+	}
+
+	//i8x32еСб(fast_double_parser::decimal_separators)һַֽ
+	template<class _Sep>
+	really_inline __m256i x_mm256_cmpeq_any(__m256i, fast_double_parser::decimal_separators<_Sep>) noexcept
+	{
+		return _mm256_setzero_si256();
+	}
+
+	template<class _Sep, _Sep _First, _Sep... _Rest>
+	really_inline __m256i x_mm256_cmpeq_any(__m256i i8x32, fast_double_parser::decimal_separators<_Sep, _First, _Rest...>) noexcept
+	{
+		return _mm256_or_si256(_mm256_cmpeq_epi8(i8x32, _mm256_set1_epi8((char)_First)),
+			x_mm256_cmpeq_any(i8x32, fast_double_parser::decimal_separators<_Sep, _Rest...>()));
+	}
+
+	//AVX2ǰˣһμ32ֽڣ/С/ָ/ĸλ룬
+	//ȻtzcntֱСָεĳȣַ֧
+	//ֻġ32ַЧֲ18λ
+	//(зǷ룬Լ_Policyд)falseַͨ㷨
+	//_Resultx_mode_result<_Mode>::type
+	template<x_parse_mode _Mode, bool _Padded, class _Policy, class _CharType, class _Result>
+	really_inline bool x_mm256_parse_token(const _CharType*&, const _CharType* const, _Result&) noexcept
+	{
+		return false;
+	}
+
+	template<x_parse_mode _Mode, bool _Padded, class _Policy, class _Result>
+	really_inline bool x_mm256_parse_token(const char*& s, const char* const pszEnd, _Result& result) noexcept
+	{
+		const char* psz = s;
+		intptr_t remaind = pszEnd - psz;
+		//Сӵ31ֽڿʼ16ֽ
+		if (!_Padded && (remaind <= 0 || (remaind < 48 && !x_is_safe_load(psz, 48))))
+			return false;
+
+		__m256i i8x32 = _mm256_loadu_si256((const __m256i*)psz);
+		uint32_t valid = (_Padded || remaind >= 32) ? 0xffffffffu : ((1u << remaind) - 1);
+
+		__m256i i8x32_sub = _mm256_sub_epi8(i8x32, _mm256_set1_epi8('0'));
+		__m256i i8x32_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(i8x32_sub, _mm256_set1_epi8(9)), i8x32_sub);
+		__m256i i8x32_dot = x_mm256_cmpeq_any(i8x32, typename _Policy::separators());
+		__m256i i8x32_exp = _mm256_cmpeq_epi8(_mm256_or_si256(i8x32, _mm256_set1_epi8(32)), _mm256_set1_epi8(_Policy::exponent_char | 32));
+		__m256i i8x32_sign = _mm256_or_si256(_mm256_cmpeq_epi8(i8x32, _mm256_set1_epi8('-')), _mm256_cmpeq_epi8(i8x32, _mm256_set1_epi8('+')));
+
+		uint32_t digit_mask = (uint32_t)_mm256_movemask_epi8(i8x32_digit) & valid;
+		uint32_t dot_mask = (uint32_t)_mm256_movemask_epi8(i8x32_dot) & valid;
+		uint32_t exp_mask = (uint32_t)_mm256_movemask_epi8(i8x32_exp) & valid;
+		uint32_t sign_mask = (uint32_t)_mm256_movemask_epi8(i8x32_sign) & valid;
+
+		//
+		uint32_t int_pos = sign_mask & 1;
+		bool minus = int_pos && *psz == '-';
+		if (int_pos && !minus && !_Policy::leading_plus)
+			return false;
+		uint32_t int_len = x_count_run(digit_mask, int_pos);
+		if (int_len == 0 || int_len > 16)
+			return false;
+		//0ֻܸС㣬("0", "0e5", "012")ͨ㷨
+		if (psz[int_pos] == '0' && !((dot_mask >> (int_pos + 1)) & 1))
+			return false;
+
+		//ǧλָ1~3֣֮ÿǷָ3֮֡int_lenֵĸint_charsַ
+		uint32_t int_chars = int_len;
+		if (_Policy::group_separator != 0)
+		{
+			uint32_t group_mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(i8x32, _mm256_set1_epi8(_Policy::group_separator))) & valid;
+			if ((group_mask >> (int_pos + int_len)) & 1)
+			{
+				int_chars = x_count_run(digit_mask | group_mask, int_pos);
+				uint32_t groups = (int_chars - int_len) / 4;
+				//15ַ(12)һpshufbѹĺ͸ʽԵĽͨ㷨
+				if (int_len > 3 || int_chars > 15 || (int_chars - int_len) % 4 != 0 ||
+					(group_mask & (((1u << int_chars) - 1) << int_pos)) != ((0x111u & ((1u << (4 * groups)) - 1)) << (int_pos + int_len)))
+					return false;
+				int_len = int_chars - groups;
+			}
+		}
+
+		//С
+		uint32_t pos = int_pos + int_chars;
+		uint32_t frac_pos = pos;
+		uint32_t frac_len = 0;
+		bool useDouble = false;
+		if ((dot_mask >> pos) & 1)
+		{
+			useDouble = true;
+			frac_pos = pos + 1;
+			frac_len = x_count_run(digit_mask, frac_pos);
+			if (frac_len > 16 || int_len + frac_len > 18 || (frac_len == 0 && !_Policy::trailing_point))
+				return false;
+			pos = frac_pos + frac_len;
+		}
+
+		//ָ
+		intptr_t exp = 0;
+		if (pos < 32 && ((exp_mask >> pos) & 1))
+		{
+			useDouble = true;
+			uint32_t exp_pos = pos + 1;
+			bool expMinus = false;
+			if (exp_pos < 32 && ((sign_mask >> exp_pos) & 1))
+			{
+				expMinus = psz[exp_pos] == '-';
+				++exp_pos;
+			}
+			uint32_t exp_len = x_count_run(digit_mask, exp_pos);
+			if (exp_len == 0 || exp_len > 9)
+				return false;
+			pos = exp_pos + exp_len;
+			if (pos >= 32)
+				return false;
+
+			exp = (intptr_t)x_mm_convert_digitx16_long(psz + exp_pos, exp_len);
+			if (expMinus)
+				exp = -exp;
+		}
+		//32ֽڽģʽ»ԽpszEnd
+		if (pos >= 32 || (_Padded && pos > remaind))
+			return false;
+		//ʮָ֪תЧ֮ǰԤȡ10ݱ(FAST_DOUBLE_PARSER_PREFETCHδʱΪ)
+		if (useDouble && (_Mode == x_mode_exact || _Mode == x_mode_float))
+			fast_double_parser::prefetch_power_of_ten((int64_t)exp - (int64_t)frac_len);
+
+		uint64_t i64 = int_chars == int_len
+			? x_mm_convert_digitx16_long(psz + int_pos, int_len)
+			: x_mm_cvt_grouped_i8x16_long(_mm_loadu_si128((const __m128i*)(psz + int_pos)), int_chars);
+		if (frac_len > 0)
+		{
+			i64 = i64 * LONG_E[frac_len] + x_mm_convert_digitx16_long(psz + frac_pos, frac_len);
+			exp -= frac_len;
+		}
+
+		s = psz + pos;
+		result = x_make_number_mode<_Mode, _Policy>(minus, useDouble, false, i64, exp, psz, s);
+		return true;
+	}
+#endif
+
+	//ʮƸ(printf%aʽ)"0x1.91eb851eb851fp+1"﷨fast_double_parser::parse_hex_baseͬ
+	//Ч־ǶƵģҪ10ݱȷģ_Mode=x_mode_floatʱfloatdouble
+	template<x_parse_mode _Mode, class _CharType>
+	std::tuple<number_value, parser_result> simd_hex_parser2(const _CharType*& s, const _CharType* const pszEnd) noexcept
 	{
 		const _CharType* psz = s;
 
+		bool minus = false;
+		if (psz < pszEnd && (*psz == '-' || *psz == '+'))
+		{
+			minus = *psz == '-';
+			++psz;
+		}
+
+		if (pszEnd - psz < 2 || psz[0] != '0' || (psz[1] | 32) != 'x')
+		{
+			s = psz;
+			return { number_value{0}, parser_result::Invalid };
+		}
+		psz += 2;
+
+		uint64_t m = 0;
+		int kept = 0;
+		int64_t dropped = 0;
+		bool truncated = false;
+		intptr_t exp = 0;	//ָ
+
+		const _CharType* const pszDigits = psz;
+		for (; psz < pszEnd && *psz == '0'; ++psz);	//0
+		x_mm_convert_string_hex(psz, pszEnd, m, kept, dropped, truncated);
+		exp += (intptr_t)(4 * dropped);
+		bool anyDigit = psz != pszDigits;
+
+		if (psz < pszEnd && *psz == '.')
+		{
+			++psz;
+			const _CharType* const pszDot = psz;
+			if (kept == 0)
+				for (; psz < pszEnd && *psz == '0'; ++psz);
+
+			dropped = 0;
+			x_mm_convert_string_hex(psz, pszEnd, m, kept, dropped, truncated);
+			exp -= (intptr_t)(4 * ((psz - pszDot) - dropped));
+			anyDigit |= psz != pszDot;
+		}
+
+		if (!anyDigit)
+		{
+			s = psz;
+			return { number_value{0}, parser_result::Invalid };
+		}
+
+		if (psz < pszEnd && (*psz | 32) == 'p')
+		{//ֱָʮƵ
+			++psz;
+
+			bool expMinus = false;
+			if (psz < pszEnd && (*psz == '+' || *psz == '-'))
+			{
+				expMinus = *psz == '-';
+				++psz;
+			}
+
+			if (psz >= pszEnd || !x_is_digit(*psz))
+			{
+				s = psz;
+				return { number_value{0}, parser_result::Invalid };
+			}
+
+			bool overflow = false;
+			uint64_t e2 = x_mm_convert_string_long<false>(0, psz, pszEnd, overflow, x_int64_limit());
+			if (overflow || e2 > ((std::numeric_limits<int32_t>::max)() / 2))
+			{
+				s = psz;
+				return { number_value{0}, parser_result::Invalid };
+			}
+
+			if (expMinus)
+				exp -= (intptr_t)e2;
+			else
+				exp += (intptr_t)e2;
+		}
+
+		s = psz;
+		number_value nv;
+		if (_Mode == x_mode_float)
+		{
+			nv.f = fast_double_parser::compute_float_hex<float>(exp, m, minus, truncated);
+			return { nv, parser_result::Float };
+		}
+		nv.d = fast_double_parser::compute_float_hex<double>(exp, m, minus, truncated);
+		return { nv, parser_result::Double };
+	}
+
+	//_Paddedx_before_end
+	//_Mode=x_mode_exactʱstrtodȫһ£x_mode_floatʱstrtofȫһ£
+	//x_mode_fastʱֱDOUBLE_E/DOUBLE_NEˣмulp
+	//_Policy﷨(fast_double_parser::json_policy)дڱھȥ˶Ӧķ֧
+	template<x_parse_mode _Mode, bool _Padded, class _Policy, class _CharType>
+	typename x_mode_result<_Mode>::type simd_double_parser2(const _CharType*& s, const _CharType* const pszEnd) noexcept
+	{
+#if SIMD_DOUBLE_PARSER_ISA >= SIMD_DOUBLE_PARSER_ISA_AVX2
+		{
+			typename x_mode_result<_Mode>::type result;
+			if (x_mm256_parse_token<_Mode, _Padded, _Policy>(s, pszEnd, result))
+				return result;
+		}
+#endif
+
+		const _CharType* psz = s;
+		if (!x_before_end<_Padded>(psz, pszEnd))
+		{
+			return x_make_invalid<_Mode>();
+		}
+
 		//ȴ
 		bool minus = *psz == '-';
 		if (minus) ++psz;
-		else if (*psz == '+') ++psz;
+		else if (_Policy::leading_plus && *psz == '+') ++psz;
 
 		if (psz >= pszEnd)
 		{
-			return { number_value{0}, parser_result::Invalid };
+			return x_make_invalid<_Mode>();
 		}
 
 		intptr_t exp = 0;
 		bool useDouble = false;	//ʼûˣҪʹø㷨
+		bool truncated = false;	//Ƿ˷0
+		bool anyDigit = true;	//Ƿһ
+		const _CharType* const pszInt = psz;	//ֵĿʼ
 		uint64_t i64;
 
 #if 1
-		if (*psz == '0')
+		if (*psz == '0' && !_Policy::leading_zeros)
 		{
 			++psz;
-			if (psz >= pszEnd)
+			if (!x_before_end<_Padded>(psz, pszEnd))
 			{
 				s = psz;
-				return { number_value{0}, parser_result::Long };
+				return x_make_number_mode<_Mode, _Policy>(minus, false, false, 0, 0, psz, psz);
 			}
-			else if (*psz == '.')
+			else if (_Policy::separators::contains(*psz))
 			{
 				i64 = 0;
 				goto label_dot;
 			}
+			else if (fast_double_parser::is_exponent_char<_Policy>(*psz))
+			{//"0e999"֮࣬(ŵ)0
+				i64 = 0;
+				goto label_exp;
+			}
 			else if (!x_is_digit(*psz))
 			{
 				s = psz;
-				return { number_value{0}, parser_result::Long };
+				return x_make_number_mode<_Mode, _Policy>(minus, false, false, 0, 0, psz, psz);
 			}
 			else
 			{
 				s = psz;
-				return { number_value{0}, parser_result::Invalid };
+				return x_make_invalid<_Mode>();
 			}
 		}
 #endif
 
-		i64 = x_mm_convert_string_long(0, psz, pszEnd, useDouble);
+		{
+			const _CharType* const pszDigits = psz;
+			if (_Policy::leading_zeros)
+			{//0ǲЧ
+				for (; x_before_end<_Padded>(psz, pszEnd) && *psz == '0'; ++psz);
+			}
+			i64 = x_mm_convert_string_long<_Padded>(0, psz, pszEnd, useDouble, x_uint64_limit());
+			anyDigit = psz != pszDigits;
+		}
+		if (!anyDigit && !(_Policy::leading_point && x_before_end<_Padded>(psz, pszEnd) && _Policy::separators::contains(*psz)))
+		{//ֿʼ(_PolicyʱС㿪ʼ)
+			s = psz;
+			return x_make_invalid<_Mode>();
+		}
+		if (_Policy::group_separator != 0 && x_before_end<_Padded>(psz, pszEnd) && fast_double_parser::is_group_separator<_Policy>(*psz))
+		{//ǧλָ1~3֣֮ÿǷָ3
+			if (!anyDigit || psz - pszInt > 3)
+			{
+				s = psz;
+				return x_make_invalid<_Mode>();
+			}
+			if (!x_mm_convert_groups<_Padded, _Policy>(i64, psz, pszEnd, useDouble, truncated, exp))
+			{
+				s = psz;
+				return x_make_invalid<_Mode>();
+			}
+			if (x_before_end<_Padded>(psz, pszEnd) && x_is_digit(*psz))
+			{//3
+				s = psz;
+				return x_make_invalid<_Mode>();
+			}
+		}
 		if (useDouble)
 		{//ʹø㷨
 			const _CharType* const pszSaved = psz;
-			for (; x_is_digit(*psz); ++psz);
-			exp = psz - pszSaved;
+			for (; x_before_end<_Padded>(psz, pszEnd) && x_is_digit(*psz); ++psz)
+				truncated |= *psz != '0';
+			exp += psz - pszSaved;
 		}
 
-		if (psz < pszEnd && *psz == '.')
+		if (x_before_end<_Padded>(psz, pszEnd) && _Policy::separators::contains(*psz))
 		{//С
 	label_dot:
 			++psz;
 			const _CharType* pszDot = psz;
+			if (!(x_before_end<_Padded>(psz, pszEnd) && x_is_digit(*psz)) && (!_Policy::trailing_point || !anyDigit))
+			{//Сû֣"5."Ҫ_Policy"."
+				s = psz;
+				return x_make_invalid<_Mode>();
+			}
 
 			if (!useDouble)
 			{//δС
@@ -532,9 +1269,11 @@ namespace
 				else if ((test_zero & 0x0000ffff) == 0x00003030)
 					psz += 2;
 */
-				//for (; psz < pszEnd && *psz == '0'; ++psz);	//0
+				//for (; x_before_end<_Padded>(psz, pszEnd) && *psz == '0'; ++psz);	//0
 
-				i64 = x_mm_convert_string_long(i64, psz, pszEnd, useDouble);
+				//x_mode_decimalfast_double_parser::scan_numberһ19λЧ֣Ҫuint64_tΧ
+				typedef typename std::conditional<_Mode == x_mode_decimal, x_uint64_limit, x_int64_limit>::type limit;
+				i64 = x_mm_convert_string_long<_Padded>(i64, psz, pszEnd, useDouble, limit());
 			}
 
 			if (useDouble)
@@ -542,7 +1281,8 @@ namespace
 				exp += pszDot - psz;	//ĸָ
 
 				//Ѿִﾫޣַٷ
-				for (; x_is_digit(*psz); ++psz);
+				for (; x_before_end<_Padded>(psz, pszEnd) && x_is_digit(*psz); ++psz)
+					truncated |= *psz != '0';
 			}
 			else
 			{
@@ -551,7 +1291,15 @@ namespace
 			}
 		}
 
-		if (psz < pszEnd && (*psz | 32) == 'e')
+	label_exp:
+		if (_Mode == x_mode_decimal && useDouble && i64 >= 10000000000000000000ULL)
+		{//fast_double_parser::scan_numberһ£ֻв2^64ûС20λֱ20λ
+		 //20λߺСʱֻǰ19λ20λָ
+			truncated |= i64 % 10 != 0;
+			i64 /= 10;
+			++exp;
+		}
+		if (x_before_end<_Padded>(psz, pszEnd) && fast_double_parser::is_exponent_char<_Policy>(*psz))
 		{//ָ
 			if (!useDouble)
 			{//֮ǰҪոн
@@ -560,29 +1308,29 @@ namespace
 			++psz;
 
 			bool expMinus = false;
-			if (psz < pszEnd && *psz == '+')
+			if (x_before_end<_Padded>(psz, pszEnd) && *psz == '+')
 			{
 				++psz;
 			}
-			else if (psz < pszEnd && *psz == '-')
+			else if (x_before_end<_Padded>(psz, pszEnd) && *psz == '-')
 			{
 				++psz;
 				expMinus = true;
 			}
 
-			if (psz >= pszEnd)
-			{
+			if (!x_before_end<_Padded>(psz, pszEnd) || !x_is_digit(*psz))
+			{//eҪһ
 				s = psz;
-				return { number_value{0}, parser_result::Invalid };
+				return x_make_invalid<_Mode>();
 			}
 
 			bool overflow = false;	//ʼûˣΪһЧ
-			uint64_t e2 = x_mm_convert_string_long(0, psz, pszEnd, overflow);
+			uint64_t e2 = x_mm_convert_string_long<_Padded>(0, psz, pszEnd, overflow, x_int64_limit());
 
 			if (overflow || e2 > ((std::numeric_limits<int32_t>::max)() / 2))
 			{
 				s = psz;
-				return { number_value{0}, parser_result::Invalid };
+				return x_make_invalid<_Mode>();
 			}
 
 			//ָۻȥ
@@ -592,57 +1340,44 @@ namespace
 				exp += (intptr_t)e2;
 		}
 
-		if (useDouble)
-		{
-			double dval;
-/*
-			bool success = true;
-			dval = fast_double_parser::compute_float_64(exp, i64, false, &success);
-			if (!success)
-*/
-			{
-				if (exp < -330)	//330 = 308 + 22
-				{
-					dval = 0.0;
-				}
-				else if (exp < -308)
-				{
-					dval = x_fast_path((double)i64, -308);
-					dval = x_fast_path(dval, exp + 308);
-				}
-				else if (exp > 330)	//330 = 308 + 22
-				{
-					dval = INFINITY;
-				}
-				else if (exp > 308)
-				{
-					dval = x_fast_path((double)i64, 308);
-					dval = x_fast_path(dval, exp - 308);
-				}
-				else if (exp != 0)
-				{
-					dval = x_fast_path((double)i64, exp);
-				}
-				else
-				{
-					dval = (double)i64;
-				}
-			}
-
-			number_value nv;
-			nv.d = minus ? -dval : dval;
-
+		if (_Padded && psz > pszEnd)
+		{//ģʽΨһı߽
 			s = psz;
-			return { nv, parser_result::Double };
+			return x_make_invalid<_Mode>();
 		}
-		else
+
+		const _CharType* const pszBegin = s;
+		s = psz;
+		return x_make_number_mode<_Mode, _Policy>(minus, useDouble, truncated, i64, exp, pszBegin, psz);
+	}
+
+	//x_parser_Hex_PaddedѡֻʵõһʮûвģʽҲ_Policy
+	template<x_parse_mode _Mode, bool _Hex, bool _Padded, class _Policy>
+	struct x_kernel
+	{
+		template<class _CharType>
+		static typename x_mode_result<_Mode>::type parse(const _CharType*& s, const _CharType* const pszEnd) noexcept
 		{
-			number_value nv;
-			nv.l = minus ? -(int64_t)i64 : (int64_t)i64;
+			return simd_double_parser2<_Mode, _Padded, _Policy>(s, pszEnd);
+		}
+	};
 
-			s = psz;
-			return { nv, parser_result::Long };
+	template<x_parse_mode _Mode, class _Policy>
+	struct x_kernel<_Mode, true, false, _Policy>
+	{
+		template<class _CharType>
+		static typename x_mode_result<_Mode>::type parse(const _CharType*& s, const _CharType* const pszEnd) noexcept
+		{
+			return simd_hex_parser2<_Mode>(s, pszEnd);
 		}
-	}
+	};
 
 }
+
+#if SIMD_DOUBLE_PARSER_ISA > SIMD_DOUBLE_PARSER_ISA_SSE2
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+#endif
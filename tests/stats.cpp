@@ -19,10 +19,11 @@ enum {
   ZERO_PATH = 1,
   SLOW_PATH = 2,
   SLOWER_PATH = 3,
-  FAILURE = 4,
-  COULD_NOT_ROUND = 5,
-  EXPONENT_FAILURE = 6,
-  EARLY_STRTOD = 7
+  ROUND_TO_EVEN = 4,
+  EXPONENT_FAILURE = 5,
+  EARLY_STRTOD = 6,
+  SUBNORMAL_PATH = 7,
+  SECONDARY_FAST_PATH = 8
 };
 
 size_t compute_float_64_stats(int64_t power, uint64_t i) {
@@ -37,17 +38,20 @@ size_t compute_float_64_stats(int64_t power, uint64_t i) {
   if (i == 0) {
     return ZERO_PATH;
   }
+  // Gay's secondary fast path: (i * 10^(power - 22)) * 10^22
+  if (22 < power && power <= 22 + 15 &&
+      i <= fast_double_parser::max_mantissa_fast_path[power - 22]) {
+    return SECONDARY_FAST_PATH;
+  }
 
   // We are going to need to do some 64-bit arithmetic to get a more precise
   // product. We use a table lookup approach.
-  fast_double_parser::components c = fast_double_parser::power_of_ten_components
+  // we recover the mantissa of the power, it has a leading 1.
+  uint64_t factor_mantissa = fast_double_parser::power_of_ten_mantissa_64
       [power -
        FASTFLOAT_SMALLEST_POWER]; // safe because
                                   // power >= FASTFLOAT_SMALLEST_POWER
                                   // and power <= FASTFLOAT_LARGEST_POWER
-  // we recover the mantissa of the power, it has a leading 1. It is always
-  // rounded down.
-  uint64_t factor_mantissa = c.mantissa;
   // We want the most significant bit of i to be 1. Shift if needed.
   int lz = fast_double_parser::leading_zeroes(i);
   i <<= lz;
@@ -58,40 +62,19 @@ size_t compute_float_64_stats(int64_t power, uint64_t i) {
       fast_double_parser::full_multiplication(i, factor_mantissa);
   uint64_t lower = product.low;
   uint64_t upper = product.high;
-  // We know that upper has at most one leading zero because
-  // both i and  factor_mantissa have a leading one. This means
-  // that the result is at least as large as ((1<<63)*(1<<63))/(1<<64).
-
   // As long as the first 9 bits of "upper" are not "1", then we
   // know that we have an exact computed value for the leading
-  // 55 bits because any imprecision would play out as a +1, in
-  // the worst case.
-  // We expect this next branch to be rarely taken (say 1% of the time).
-  // When (upper & 0x1FF) == 0x1FF, it can be common for
-  // lower + i < lower to be true (proba. much higher than 1%).
+  // 55 bits. Otherwise we need the next 64 bits of the power; the
+  // resulting 128 bits are always enough.
   int answer = SLOW_PATH;
-  if (unlikely((upper & 0x1FF) == 0x1FF) && (lower + i < lower)) {
-    uint64_t factor_mantissa_low =
-        fast_double_parser::mantissa_128[power - FASTFLOAT_SMALLEST_POWER];
-    // next, we compute the 64-bit x 128-bit multiplication, getting a 192-bit
-    // result (three 64-bit values)
-    product = fast_double_parser::full_multiplication(i, factor_mantissa_low);
-    uint64_t product_low = product.low;
-    uint64_t product_middle2 = product.high;
-    uint64_t product_middle1 = lower;
-    uint64_t product_high = upper;
-    uint64_t product_middle = product_middle1 + product_middle2;
-    if (product_middle < product_middle1) {
-      product_high++; // overflow carry
+  if (unlikely((upper & 0x1FF) == 0x1FF)) {
+    fast_double_parser::value128 product_low =
+        fast_double_parser::full_multiplication(
+            i, fast_double_parser::mantissa_128[power - FASTFLOAT_SMALLEST_POWER]);
+    lower += product_low.high;
+    if (product_low.high > lower) {
+      upper++; // overflow carry
     }
-    // we want to check whether mantissa *i + i would affect our result
-    // This does happen, e.g. with 7.3177701707893310e+15
-    if (((product_middle + 1 == 0) && ((product_high & 0x1FF) == 0x1FF) &&
-         (product_low + i < product_low))) { // let us be prudent and bail out.
-      return FAILURE;
-    }
-    upper = product_high;
-    lower = product_middle;
     answer = SLOWER_PATH;
   }
   // The final mantissa should be 53 bits with a leading 1.
@@ -101,15 +84,18 @@ size_t compute_float_64_stats(int64_t power, uint64_t i) {
   uint64_t mantissa = upper >> (upperbit + 9);
   lz += int(1 ^ upperbit);
   // Here we have mantissa < (1<<54).
+  int64_t real_exponent = fast_double_parser::power_of_ten_exponent(power) - lz;
+  if (unlikely(real_exponent <= 0)) {
+    return SUBNORMAL_PATH;
+  }
 
-  // We have to round to even. The "to even" part
-  // is only a problem when we are right in between two floats
-  // which we guard against.
-  // If we have lots of trailing zeros, we may fall right between two
-  // floating-point values.
-  if (unlikely((lower == 0) && ((upper & 0x1FF) == 0) &&
+  // We may be right in between two floats, then we round to even.
+  if (unlikely((lower <= 1) && (power >= -4) && (power <= 23) &&
                ((mantissa & 3) == 1))) {
-    return COULD_NOT_ROUND;
+    if ((mantissa << (upperbit + 9)) == upper) {
+      mantissa &= ~uint64_t(1);
+      answer = ROUND_TO_EVEN;
+    }
   }
   mantissa += mantissa & 1;
   mantissa >>= 1;
@@ -119,15 +105,14 @@ size_t compute_float_64_stats(int64_t power, uint64_t i) {
     // This will happen when parsing values such as 7.2057594037927933e+16
     ////////
     mantissa = (1ULL << 52);
-    lz--; // undo previous addition
+    real_exponent++;
   }
   mantissa &= ~(1ULL << 52);
-  uint64_t real_exponent = c.exp - lz;
-  // we have to check that real_exponent is in range, otherwise we bail out
-  if (unlikely((real_exponent < 1) || (real_exponent > 2046))) {
+  // past the largest double, we bail out
+  if (unlikely(real_exponent > 2046)) {
     return EXPONENT_FAILURE;
   }
-  mantissa |= real_exponent << 52;
+  mantissa |= uint64_t(real_exponent) << 52;
   double d;
   memcpy(&d, &mantissa, sizeof(d));
   // printf("answer = %zu\n", answer);
@@ -254,10 +239,12 @@ size_t parse_number_stats(const char *p) {
       return EARLY_STRTOD;
     }
   }
-  if (unlikely(exponent < FASTFLOAT_SMALLEST_POWER) ||
-      (exponent > FASTFLOAT_LARGEST_POWER)) {
+  if (unlikely(i == 0 || exponent < FASTFLOAT_SMALLEST_POWER)) {
+    // a signed zero, no need for compute_float_64
+    return ZERO_PATH;
+  }
+  if (unlikely(exponent > FASTFLOAT_LARGEST_POWER)) {
     // this is almost never going to get called!!!
-    // exponent could be as low as 325
     return EARLY_STRTOD;
   }
   // from this point forward, exponent >= FASTFLOAT_SMALLEST_POWER and
@@ -271,7 +258,7 @@ void random_floats(bool ininterval) {
     printf("in interval [0,1]\n");
   else
     printf(" (all normals)\n");
-  size_t counters[] = {0, 0, 0, 0, 0, 0, 0, 0};
+  size_t counters[] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
   uint64_t offset = 1190;
   size_t howmany = 10000000;
   for (size_t i = 1; i <= howmany; i++) {
@@ -304,16 +291,18 @@ void random_floats(bool ininterval) {
   printf("==========\n");
   printf("fast path %zu (%.5f %%) \n", counters[FAST_PATH],
          counters[FAST_PATH] * 100. / count);
+  printf("secondary fast path %zu (%.5f %%) \n", counters[SECONDARY_FAST_PATH],
+         counters[SECONDARY_FAST_PATH] * 100. / count);
   printf("zero path %zu (%.5f %%) \n", counters[ZERO_PATH],
          counters[ZERO_PATH] * 100. / count);
   printf("slow path %zu  (%.5f %%) \n", counters[SLOW_PATH],
          counters[SLOW_PATH] * 100. / count);
   printf("slower path %zu (%.5f %%) \n", counters[SLOWER_PATH],
          counters[SLOWER_PATH] * 100. / count);
-  printf("failure %zu (%.5f %%) \n", counters[FAILURE],
-         counters[FAILURE] * 100. / count);
-  printf("could not round %zu (%.5f %%) \n", counters[COULD_NOT_ROUND],
-         counters[COULD_NOT_ROUND] * 100. / count);
+  printf("round to even %zu (%.5f %%) \n", counters[ROUND_TO_EVEN],
+         counters[ROUND_TO_EVEN] * 100. / count);
+  printf("subnormal path %zu (%.5f %%) \n", counters[SUBNORMAL_PATH],
+         counters[SUBNORMAL_PATH] * 100. / count);
   printf("exponent failure %zu  (%.5f %%) \n", counters[EXPONENT_FAILURE],
          counters[EXPONENT_FAILURE] * 100. / count);
   printf("early bail %zu (%.5f %%) \n", counters[EARLY_STRTOD],
@@ -321,7 +310,7 @@ void random_floats(bool ininterval) {
 }
 
 void fileload(char *filename) {
-  size_t counters[] = {0, 0, 0, 0, 0, 0, 0, 0};
+  size_t counters[] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
 
   std::ifstream inputfile(filename);
   if (!inputfile) {
@@ -340,16 +329,18 @@ void fileload(char *filename) {
   printf("==========\n");
   printf("fast path %zu (%.5f %%) \n", counters[FAST_PATH],
          counters[FAST_PATH] * 100. / count);
+  printf("secondary fast path %zu (%.5f %%) \n", counters[SECONDARY_FAST_PATH],
+         counters[SECONDARY_FAST_PATH] * 100. / count);
   printf("zero path %zu (%.5f %%) \n", counters[ZERO_PATH],
          counters[ZERO_PATH] * 100. / count);
   printf("slow path %zu  (%.5f %%) \n", counters[SLOW_PATH],
          counters[SLOW_PATH] * 100. / count);
   printf("slower path %zu (%.5f %%) \n", counters[SLOWER_PATH],
          counters[SLOWER_PATH] * 100. / count);
-  printf("failure %zu (%.5f %%) \n", counters[FAILURE],
-         counters[FAILURE] * 100. / count);
-  printf("could not round %zu (%.5f %%) \n", counters[COULD_NOT_ROUND],
-         counters[COULD_NOT_ROUND] * 100. / count);
+  printf("round to even %zu (%.5f %%) \n", counters[ROUND_TO_EVEN],
+         counters[ROUND_TO_EVEN] * 100. / count);
+  printf("subnormal path %zu (%.5f %%) \n", counters[SUBNORMAL_PATH],
+         counters[SUBNORMAL_PATH] * 100. / count);
   printf("exponent failure %zu  (%.5f %%) \n", counters[EXPONENT_FAILURE],
          counters[EXPONENT_FAILURE] * 100. / count);
   printf("early bail %zu (%.5f %%) \n", counters[EARLY_STRTOD],